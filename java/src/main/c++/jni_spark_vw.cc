@@ -17,9 +17,11 @@
 #include "vw/text_parser/parse_example_text.h"
 
 #include <algorithm>
+#include <cstring>
 #include <exception>
 
 jobject getJavaPrediction(JNIEnv* env, VW::workspace* all, example* ex);
+void addNamespaceIfNotExists(VW::workspace* all, example* ex, char ns);
 
 // Will finish the examples too
 template <bool isLearn>
@@ -224,6 +226,142 @@ JNIEXPORT jobject JNICALL Java_org_vowpalwabbit_spark_VowpalWabbitNative_predict
   }
 }
 
+// Sequential reader over a packed example chunk, see VowpalWabbitNative.learnBatch for the layout.
+class PackedExampleReader
+{
+  const char* _cur;
+  const char* _end;
+
+public:
+  PackedExampleReader(const char* data, size_t length) : _cur(data), _end(data + length) {}
+
+  template <typename T>
+  T read()
+  {
+    T value;
+    read_array(&value, 1);
+    return value;
+  }
+
+  template <typename T>
+  void read_array(T* out, size_t count)
+  {
+    const size_t bytes = sizeof(T) * count;
+    if (static_cast<size_t>(_end - _cur) < bytes) { THROW("Packed example buffer is truncated"); }
+    std::memcpy(out, _cur, bytes);
+    _cur += bytes;
+  }
+
+  // Returns a pointer to count unaligned values of T and skips them.
+  const char* skip(size_t count, size_t size)
+  {
+    const size_t bytes = size * count;
+    if (static_cast<size_t>(_end - _cur) < bytes) { THROW("Packed example buffer is truncated"); }
+    const char* start = _cur;
+    _cur += bytes;
+    return start;
+  }
+};
+
+template <bool isLearn>
+void runPackedBatch(JNIEnv* env, VW::workspace* all, jobject examples, jint count, jobject predictions)
+{
+  if (all->l->is_multiline()) { THROW("Packed batches require a single line learner"); }
+  if (all->example_parser->lbl_parser.label_type != VW::label_type_t::SIMPLE)
+  {
+    THROW("Packed batches require a reduction stack that uses simple labels");
+  }
+  if (all->l->get_output_prediction_type() != VW::prediction_type_t::SCALAR)
+  {
+    THROW("Packed batches require a learner with scalar predictions");
+  }
+
+  auto* data = static_cast<const char*>(env->GetDirectBufferAddress(examples));
+  const jlong data_length = env->GetDirectBufferCapacity(examples);
+  auto* output = static_cast<char*>(env->GetDirectBufferAddress(predictions));
+  const jlong output_length = env->GetDirectBufferCapacity(predictions);
+  if (data == nullptr || output == nullptr || data_length < 0 || output_length < 0)
+  {
+    THROW("Packed batches require direct buffers");
+  }
+  if (count < 0 || static_cast<size_t>(output_length) < sizeof(float) * count)
+  {
+    THROW("Prediction buffer holds fewer than " << count << " floats");
+  }
+
+  PackedExampleReader reader(data, static_cast<size_t>(data_length));
+  const uint64_t mask = (static_cast<uint64_t>(1) << all->num_bits) - 1;
+  for (jint i = 0; i < count; i++)
+  {
+    auto* ex = VW::new_unused_example(*all);
+    const auto label = reader.read<float>();
+    const auto weight = reader.read<float>();
+    if (isLearn)
+    {
+      ex->l.simple.label = label;
+      ex->ex_reduction_features.template get<VW::simple_label_reduction_features>().weight = weight;
+    }
+
+    const auto num_namespaces = reader.read<int32_t>();
+    for (int32_t n = 0; n < num_namespaces; n++)
+    {
+      const auto ns = static_cast<unsigned char>(reader.read<int32_t>());
+      const auto num_features = reader.read<int32_t>();
+      if (num_features < 0) { THROW("Negative feature count in packed example " << i); }
+      const char* indices = reader.skip(num_features, sizeof(int32_t));
+      const char* values = reader.skip(num_features, sizeof(float));
+
+      addNamespaceIfNotExists(all, ex, ns);
+      auto& fs = ex->feature_space[ns];
+      for (int32_t f = 0; f < num_features; f++)
+      {
+        int32_t index;
+        float x;
+        std::memcpy(&index, indices + sizeof(int32_t) * f, sizeof(int32_t));
+        std::memcpy(&x, values + sizeof(float) * f, sizeof(float));
+        if (x != 0) { fs.push_back(x, static_cast<uint32_t>(index) & mask); }
+      }
+    }
+
+    VW::setup_example(*all, ex);
+    if VW_STD17_CONSTEXPR (isLearn) { all->learn(*ex); }
+    else { all->predict(*ex); }
+    const float prediction = ex->pred.scalar;
+    std::memcpy(output + sizeof(float) * i, &prediction, sizeof(float));
+    VW::finish_example(*all, *ex);
+  }
+}
+
+JNIEXPORT void JNICALL Java_org_vowpalwabbit_spark_VowpalWabbitNative_learnBatch(
+    JNIEnv* env, jobject vwObj, jobject examples, jint count, jobject predictions)
+{
+  auto* all = reinterpret_cast<VW::workspace*>(get_native_pointer(env, vwObj));
+
+  try
+  {
+    runPackedBatch<true>(env, all, examples, count, predictions);
+  }
+  catch (...)
+  {
+    rethrow_cpp_exception_as_java_exception(env);
+  }
+}
+
+JNIEXPORT void JNICALL Java_org_vowpalwabbit_spark_VowpalWabbitNative_predictBatch(
+    JNIEnv* env, jobject vwObj, jobject examples, jint count, jobject predictions)
+{
+  auto* all = reinterpret_cast<VW::workspace*>(get_native_pointer(env, vwObj));
+
+  try
+  {
+    runPackedBatch<false>(env, all, examples, count, predictions);
+  }
+  catch (...)
+  {
+    rethrow_cpp_exception_as_java_exception(env);
+  }
+}
+
 JNIEXPORT void JNICALL Java_org_vowpalwabbit_spark_VowpalWabbitNative_performRemainingPasses(JNIEnv* env, jobject vwObj)
 {
   auto* all = reinterpret_cast<VW::workspace*>(get_native_pointer(env, vwObj));
@@ -2,6 +2,7 @@ package org.vowpalwabbit.spark;
 
 import common.Native;
 import java.io.Closeable;
+import java.nio.ByteBuffer;
 import java.util.Collection;
 import java.util.Iterator;
 
@@ -70,6 +71,48 @@ public class VowpalWabbitNative implements Closeable {
      */
     public native Object predictFromString(String examplesString);
 
+    /**
+     * Learn from a chunk of pre-hashed single line examples in one native call.
+     *
+     * <p>
+     * {@code examples} is a direct buffer in native byte order holding
+     * {@code count} examples back to back. Each example is laid out as
+     * </p>
+     * <pre>
+     * float label
+     * float weight
+     * int   numberOfNamespaces
+     * numberOfNamespaces times:
+     *   int   namespace (the namespace character)
+     *   int   numberOfFeatures
+     *   int   indices[numberOfFeatures]
+     *   float values[numberOfFeatures]
+     * </pre>
+     * <p>
+     * Indices are masked to the number of bits like
+     * {@link VowpalWabbitExample#addToNamespaceSparse}. The learner must be a
+     * single line learner with simple labels and scalar predictions.
+     * </p>
+     *
+     * @param examples    direct buffer of packed examples.
+     * @param count       number of examples in {@code examples}.
+     * @param predictions direct buffer in native byte order receiving the
+     *                    one-step ahead prediction of each example as a float.
+     */
+    public native void learnBatch(ByteBuffer examples, int count, ByteBuffer predictions);
+
+    /**
+     * Predict for a chunk of pre-hashed single line examples in one native call.
+     * The layout is the same as for {@link #learnBatch}, labels and weights are
+     * ignored.
+     *
+     * @param examples    direct buffer of packed examples.
+     * @param count       number of examples in {@code examples}.
+     * @param predictions direct buffer in native byte order receiving the
+     *                    prediction of each example as a float.
+     */
+    public native void predictBatch(ByteBuffer examples, int count, ByteBuffer predictions);
+
     /**
      * Perform remaining passes.
      */
@@ -3,6 +3,8 @@ package org.vowpalwabbit.spark;
 import org.junit.Test;
 import static org.junit.Assert.*;
 import java.io.*;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
 import java.nio.file.*;
 import java.nio.charset.Charset;
 import java.nio.charset.StandardCharsets;
@@ -432,4 +434,65 @@ public class VowpalWabbitNativeIT {
             }
         }
     }
+
+    @Test
+    public void testLearnBatchMatchesExamples() throws Exception {
+        int[][] indices = { { 1, 5, 9 }, { 2, 5 }, { 9 } };
+        float[][] values = { { 1.0f, 0.5f, 2.0f }, { 3.0f, 1.0f }, { 0.25f } };
+        float[] labels = { 1.0f, 0.0f, 1.0f };
+
+        VowpalWabbitNative vw1 = null;
+        VowpalWabbitNative vw2 = null;
+        VowpalWabbitExample ex = null;
+
+        try {
+            vw1 = new VowpalWabbitNative("--quiet");
+            ex = vw1.createExample();
+            float[] expected = new float[labels.length];
+            for (int i = 0; i < labels.length; i++) {
+                double[] doubleValues = new double[values[i].length];
+                for (int j = 0; j < values[i].length; j++) {
+                    doubleValues[j] = values[i][j];
+                }
+                ex.addToNamespaceSparse('a', indices[i], doubleValues);
+                ex.setLabel(labels[i]);
+                ex.learn();
+                expected[i] = ((ScalarPrediction) ex.getPrediction()).getValue();
+                ex.clear();
+            }
+
+            int size = 0;
+            for (int i = 0; i < labels.length; i++) {
+                size += 4 * (4 + 2 * indices[i].length);
+            }
+            ByteBuffer packed = ByteBuffer.allocateDirect(size).order(ByteOrder.nativeOrder());
+            for (int i = 0; i < labels.length; i++) {
+                packed.putFloat(labels[i]).putFloat(1.0f).putInt(1).putInt('a').putInt(indices[i].length);
+                for (int index : indices[i]) {
+                    packed.putInt(index);
+                }
+                for (float value : values[i]) {
+                    packed.putFloat(value);
+                }
+            }
+            ByteBuffer predictions = ByteBuffer.allocateDirect(4 * labels.length).order(ByteOrder.nativeOrder());
+
+            vw2 = new VowpalWabbitNative("--quiet");
+            vw2.learnBatch(packed, labels.length, predictions);
+
+            for (int i = 0; i < labels.length; i++) {
+                assertEquals(expected[i], predictions.getFloat(4 * i), 1e-6);
+            }
+        } finally {
+            if (ex != null) {
+                ex.close();
+            }
+            if (vw1 != null) {
+                vw1.close();
+            }
+            if (vw2 != null) {
+                vw2.close();
+            }
+        }
+    }
 }
\ No newline at end of file
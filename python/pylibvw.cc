@@ -31,6 +31,11 @@
 #include <boost/python/suite/indexing/vector_indexing_suite.hpp>
 #include <boost/utility.hpp>
 
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
 namespace py = boost::python;
 
 class py_log_wrapper;
@@ -247,6 +252,8 @@ public:
 
   static void trace_listener_py(void* wrapper, const std::string& message)
   {
+    // Bulk calls run without the GIL, so take it here.
+    const auto gil = PyGILState_Ensure();
     try
     {
       auto inst = static_cast<py_log_wrapper*>(wrapper);
@@ -259,6 +266,7 @@ public:
       PyErr_Clear();
       std::cerr << "error using python logging. ignoring." << std::endl;
     }
+    PyGILState_Release(gil);
   }
 };
 
@@ -281,6 +289,7 @@ vw_ptr my_initialize_with_log(py::list args, py_log_wrapper_ptr py_log)
     const auto log_function = [](void* context, VW::io::log_level level, const std::string& message)
     {
       _UNUSED(level);
+      const auto gil = PyGILState_Ensure();
       try
       {
         auto inst = static_cast<py_log_wrapper*>(context);
@@ -293,6 +302,7 @@ vw_ptr my_initialize_with_log(py::list args, py_log_wrapper_ptr py_log)
         PyErr_Clear();
         std::cerr << "error using python logging. ignoring." << std::endl;
       }
+      PyGILState_Release(gil);
     };
 
     logger_ptr = VW::make_unique<VW::io::logger>(VW::io::create_custom_sink_logger(py_log.get(), log_function));
@@ -582,6 +592,218 @@ py::list my_parse(vw_ptr& all, char* str)
 
 void my_learn_multi_ex(vw_ptr& all, py::list& ec) { predict_or_learn<true>(all, ec); }
 
+// A C contiguous view over an object implementing the buffer protocol, such as a numpy array. None gives an empty,
+// invalid view. The element type must be one of formats and, unless item_size is 0, be item_size bytes wide.
+class py_buffer_view
+{
+public:
+  py_buffer_view(const py::object& obj, const char* name, const char* formats, size_t item_size, bool writable = false)
+  {
+    if (obj.is_none()) { return; }
+    const int flags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT | (writable ? PyBUF_WRITABLE : 0);
+    if (PyObject_GetBuffer(obj.ptr(), &_buffer, flags) != 0) { py::throw_error_already_set(); }
+    _valid = true;
+
+    const char* format = _buffer.format == nullptr ? "B" : _buffer.format;
+    if (*format == '<' || *format == '=' || *format == '@') { ++format; }
+    _format = *format;
+    if ((item_size != 0 && static_cast<size_t>(_buffer.itemsize) != item_size) || _format == '\0' ||
+        std::strchr(formats, _format) == nullptr)
+    {
+      THROW("Unexpected element type '" << _buffer.format << "' for " << name);
+    }
+  }
+  py_buffer_view(const py_buffer_view&) = delete;
+  py_buffer_view& operator=(const py_buffer_view&) = delete;
+  ~py_buffer_view()
+  {
+    if (_valid) { PyBuffer_Release(&_buffer); }
+  }
+
+  bool valid() const { return _valid; }
+  size_t size() const { return _valid ? static_cast<size_t>(_buffer.len / _buffer.itemsize) : 0; }
+  size_t item_size() const { return _valid ? static_cast<size_t>(_buffer.itemsize) : 0; }
+  // Lower case struct format characters are signed.
+  bool is_signed() const { return _format >= 'a' && _format <= 'z'; }
+  template <typename T>
+  T* data() const
+  {
+    return _valid ? static_cast<T*>(_buffer.buf) : nullptr;
+  }
+
+private:
+  Py_buffer _buffer{};
+  char _format = '\0';
+  bool _valid = false;
+};
+
+// Releases the GIL for its lifetime.
+class py_gil_release
+{
+public:
+  py_gil_release() : _state(PyEval_SaveThread()) {}
+  py_gil_release(const py_gil_release&) = delete;
+  py_gil_release& operator=(const py_gil_release&) = delete;
+  ~py_gil_release() { PyEval_RestoreThread(_state); }
+
+private:
+  PyThreadState* _state;
+};
+
+// Reads entry i of an integer buffer of any width as an unsigned 64 bit value. Negative entries come back out of range
+// and are caught by the bounds checks of the caller.
+uint64_t read_csr_index(const py_buffer_view& view, size_t i)
+{
+  switch (view.item_size())
+  {
+    case 1:
+      return view.is_signed() ? static_cast<uint64_t>(view.data<int8_t>()[i]) : view.data<uint8_t>()[i];
+    case 2:
+      return view.is_signed() ? static_cast<uint64_t>(view.data<int16_t>()[i]) : view.data<uint16_t>()[i];
+    case 4:
+      return view.is_signed() ? static_cast<uint64_t>(view.data<int32_t>()[i]) : view.data<uint32_t>()[i];
+    default:
+      return view.data<uint64_t>()[i];
+  }
+}
+
+template <typename IndexT, typename ValueT>
+void run_csr_rows(VW::workspace& all, const std::vector<uint64_t>& row_starts, const IndexT* columns,
+    const ValueT* values, const unsigned char* namespaces, size_t num_columns, const float* labels,
+    const float* weights, float* output, bool learn)
+{
+  std::array<uint64_t, VW::NUM_NAMESPACES> channel_hashes;
+  std::array<bool, VW::NUM_NAMESPACES> channel_hashed{};
+  for (size_t i = 0; i + 1 < row_starts.size(); i++)
+  {
+    auto* ex = VW::new_unused_example(all);
+    if (learn)
+    {
+      // Importance weights live in the label's reduction features, setup_example copies them to ex->weight.
+      ex->l.simple.label = labels[i];
+      ex->ex_reduction_features.template get<VW::simple_label_reduction_features>().weight =
+          weights != nullptr ? weights[i] : 1.f;
+    }
+
+    for (uint64_t j = row_starts[i]; j < row_starts[i + 1]; j++)
+    {
+      const auto column = static_cast<uint64_t>(columns[j]);
+      if (namespaces != nullptr && column >= num_columns)
+      {
+        // The example never reached the learner, so it goes straight back to the pool.
+        VW::details::clean_example(all, *ex);
+        THROW("Column " << column << " has no namespace");
+      }
+      const unsigned char ns = namespaces == nullptr ? VW::details::DEFAULT_NAMESPACE : namespaces[column];
+      if (!channel_hashed[ns])
+      {
+        const char name = static_cast<char>(ns);
+        channel_hashes[ns] = ns == VW::details::DEFAULT_NAMESPACE
+            ? (all.hash_seed == 0 ? 0 : VW::uniform_hash("", 0, all.hash_seed))
+            : all.example_parser->hasher(&name, 1, all.hash_seed);
+        channel_hashed[ns] = true;
+      }
+
+      auto& fs = ex->feature_space[ns];
+      if (fs.empty()) { ex->indices.push_back(ns); }
+      fs.push_back(static_cast<float>(values[j]), (column + channel_hashes[ns]) & all.parse_mask);
+    }
+
+    VW::setup_example(all, ex);
+    if (learn && !ex->test_only) { all.learn(*ex); }
+    else { as_singleline(all.l)->predict(*ex); }
+    output[i] = ex->pred.scalar;
+    VW::finish_example(all, *ex);
+  }
+}
+
+template <typename IndexT>
+void run_csr_rows(VW::workspace& all, const std::vector<uint64_t>& row_starts, const IndexT* columns,
+    const py_buffer_view& data, const unsigned char* namespaces, size_t num_columns, const float* labels,
+    const float* weights, float* output, bool learn)
+{
+  if (data.item_size() == sizeof(double))
+  {
+    run_csr_rows(
+        all, row_starts, columns, data.data<double>(), namespaces, num_columns, labels, weights, output, learn);
+  }
+  else
+  {
+    run_csr_rows(
+        all, row_starts, columns, data.data<float>(), namespaces, num_columns, labels, weights, output, learn);
+  }
+}
+
+// Learns or predicts over the rows of a CSR matrix without creating a Python object per example. Column c of a row
+// becomes the feature with index c in namespace column_namespaces[c] (the default namespace if None), which is the
+// feature "|ns c:value" would produce with the default hash. indptr and indices may hold integers of any width, as
+// scipy uses int32 or int64 depending on the matrix size, and data may hold float32 or float64 values. The buffers
+// are read in place and the GIL is released for the whole batch. The scalar prediction of row i is written to
+// predictions[i].
+void my_run_csr(vw_ptr all, py::object indptr_obj, py::object indices_obj, py::object data_obj,
+    py::object column_namespaces_obj, py::object labels_obj, py::object weights_obj, py::object predictions_obj,
+    bool learn)
+{
+  if (all->l->is_multiline()) { THROW("CSR input requires a single line learner"); }
+  if (all->example_parser->lbl_parser.label_type != VW::label_type_t::SIMPLE)
+  {
+    THROW("CSR input requires a reduction stack that uses simple labels");
+  }
+
+  const char* integer_formats = "bBhHiIlLqQ";
+  const py_buffer_view indptr(indptr_obj, "indptr", integer_formats, 0);
+  const py_buffer_view indices(indices_obj, "indices", integer_formats, 0);
+  const py_buffer_view data(data_obj, "data", "fd", 0);
+  const py_buffer_view column_namespaces(column_namespaces_obj, "column_namespaces", "BHILQ", 1);
+  const py_buffer_view labels(labels_obj, "labels", "f", sizeof(float));
+  const py_buffer_view weights(weights_obj, "weights", "f", sizeof(float));
+  const py_buffer_view predictions(predictions_obj, "predictions", "f", sizeof(float), true);
+
+  if (!indptr.valid() || indptr.size() == 0) { THROW("indptr must hold at least one entry"); }
+  const size_t rows = indptr.size() - 1;
+  // indptr only has one entry per row, widening it up front keeps the per feature loop free of conversions.
+  std::vector<uint64_t> row_starts(indptr.size());
+  for (size_t i = 0; i < row_starts.size(); i++)
+  {
+    row_starts[i] = read_csr_index(indptr, i);
+    if (row_starts[i] > indices.size() || (i > 0 && row_starts[i] < row_starts[i - 1]))
+    {
+      THROW("indptr must be non decreasing and hold offsets into indices");
+    }
+  }
+  if (indices.size() != data.size()) { THROW("indices and data must hold the same number of entries"); }
+  if (predictions.size() != rows) { THROW("predictions must hold one entry per row"); }
+  if (learn && labels.size() != rows) { THROW("labels must hold one entry per row"); }
+  if (weights.valid() && weights.size() != rows) { THROW("weights must hold one entry per row"); }
+
+  const auto* namespaces = column_namespaces.data<unsigned char>();
+  const size_t num_columns = column_namespaces.size();
+  const auto* label_values = labels.data<float>();
+  const auto* weight_values = weights.data<float>();
+  auto* output = predictions.data<float>();
+
+  py_gil_release no_gil;
+  switch (indices.item_size())
+  {
+    case 1:
+      run_csr_rows(*all, row_starts, indices.data<uint8_t>(), data, namespaces, num_columns, label_values,
+          weight_values, output, learn);
+      break;
+    case 2:
+      run_csr_rows(*all, row_starts, indices.data<uint16_t>(), data, namespaces, num_columns, label_values,
+          weight_values, output, learn);
+      break;
+    case 4:
+      run_csr_rows(*all, row_starts, indices.data<uint32_t>(), data, namespaces, num_columns, label_values,
+          weight_values, output, learn);
+      break;
+    default:
+      run_csr_rows(*all, row_starts, indices.data<uint64_t>(), data, namespaces, num_columns, label_values,
+          weight_values, output, learn);
+      break;
+  }
+}
+
 void my_predict_multi_ex(vw_ptr& all, py::list& ec) { predict_or_learn<false>(all, ec); }
 
 std::string varray_char_to_string(VW::v_array<char>& a)
@@ -1426,6 +1648,8 @@ BOOST_PYTHON_MODULE(pylibvw)
       .def("learn_multi", &my_learn_multi_ex, "given a list pyvw examples, learn (and predict) on those examples")
       .def("predict_multi", &my_predict_multi_ex, "given a list of pyvw examples, predict on that example")
       .def("_parse", &my_parse, "Parse a string into a collection of VW examples")
+      .def("_run_csr", &my_run_csr,
+          "learn or predict over the rows of a CSR matrix given as buffers, writing scalar predictions into a buffer")
       .def("_is_multiline", &my_is_multiline, "true if the base reduction is multiline")
 
       .def_readonly("lDefault", lDEFAULT,
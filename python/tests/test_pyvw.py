@@ -766,3 +766,79 @@ def test_merge_models_with_base():
     assert model2.get_weight_from_name("foo") == 0
     assert model2.get_weight_from_name("bar") != 0
     assert merged_model.get_weight_from_name("bar") != 0
+
+
+def test_learn_csr_matches_text_examples():
+    sparse = pytest.importorskip("scipy.sparse")
+    import numpy as np
+
+    X = sparse.csr_matrix(
+        np.array([[1.5, 0.0, 2.0], [0.0, 0.5, 0.0], [3.0, 1.0, 0.0]], dtype=np.float32)
+    )
+    y = [1.0, -1.0, 0.5]
+    lines = ["1 |a 0:1.5 2:2", "-1 |b 1:0.5", "0.5 |a 0:3 |b 1:1"]
+
+    text_model = Workspace(quiet=True, interactions="ab")
+    expected = []
+    for line in lines:
+        expected.append(text_model.predict(line))
+        text_model.learn(line)
+
+    csr_model = Workspace(quiet=True, interactions="ab")
+    predictions = csr_model.learn_csr(X, y, namespaces="aba")
+    assert predictions == pytest.approx(expected)
+
+    text_predictions = [text_model.predict(line) for line in lines]
+    assert csr_model.predict_csr(X, namespaces="aba") == pytest.approx(
+        text_predictions
+    )
+
+
+def test_learn_csr_sample_weight_matches_importance_weights():
+    sparse = pytest.importorskip("scipy.sparse")
+    import numpy as np
+
+    X = sparse.csr_matrix(
+        np.array([[1.5, 0.0, 2.0], [0.0, 0.5, 0.0], [3.0, 1.0, 0.0]], dtype=np.float32)
+    )
+    y = [1.0, -1.0, 0.5]
+    sample_weight = [2.0, 0.5, 3.0]
+    lines = ["1 2 | 0:1.5 2:2", "-1 0.5 | 1:0.5", "0.5 3 | 0:3 1:1"]
+
+    text_model = Workspace(quiet=True)
+    for line in lines:
+        text_model.learn(line)
+
+    csr_model = Workspace(quiet=True)
+    csr_model.learn_csr(X, y, sample_weight=sample_weight)
+
+    unweighted_model = Workspace(quiet=True)
+    unweighted_model.learn_csr(X, y)
+
+    expected = [text_model.predict(line) for line in lines]
+    assert csr_model.predict_csr(X) == pytest.approx(expected)
+    assert unweighted_model.predict_csr(X) != pytest.approx(expected)
+
+
+def test_learn_csr_reads_wide_indices_and_double_values():
+    sparse = pytest.importorskip("scipy.sparse")
+    import numpy as np
+
+    dense = np.array([[1.5, 0.0, 2.0], [0.0, 0.5, 0.0], [3.0, 1.0, 0.0]])
+    y = [1.0, -1.0, 0.5]
+
+    narrow = sparse.csr_matrix(dense.astype(np.float32))
+    narrow_model = Workspace(quiet=True)
+    expected = narrow_model.learn_csr(narrow, y)
+
+    for index_type in (np.int32, np.int64, np.uint64):
+        wide = sparse.csr_matrix(dense)
+        wide.indptr = wide.indptr.astype(index_type)
+        wide.indices = wide.indices.astype(index_type)
+        assert wide.data.dtype == np.float64
+
+        wide_model = Workspace(quiet=True)
+        assert wide_model.learn_csr(wide, y) == pytest.approx(expected)
+        assert wide_model.predict_csr(wide) == pytest.approx(
+            narrow_model.predict_csr(narrow)
+        )
@@ -736,6 +736,82 @@ class Workspace(pylibvw.vw):
 
         return prediction
 
+    def learn_csr(self, X, y, sample_weight=None, namespaces=None):
+        """Perform an online update on every row of a sparse matrix, in order
+
+        The matrix buffers are read in place, without creating an :py:class:`~vowpalwabbit.Example` per row, and the
+        GIL is released while learning. Column ``c`` of a row becomes the feature ``c`` of its namespace, as in the
+        text example ``|ns c:value``. The learner must be a single line learner with simple labels.
+
+        Args:
+            X: A CSR matrix, such as ``scipy.sparse.csr_matrix``, or any object with ``indptr``, ``indices``, ``data`` and ``shape`` attributes
+            y: One label per row
+            sample_weight: Optional importance weight per row
+            namespaces: Optional namespace per column, either a string or a sequence of single characters. Defaults to the default namespace.
+
+        Returns:
+            numpy.ndarray: The prediction made for each row before it was learned from
+        """
+        return self._run_csr(X, y, sample_weight, namespaces, True)
+
+    def predict_csr(self, X, namespaces=None):
+        """Make a prediction for every row of a sparse matrix
+
+        See :py:meth:`~vowpalwabbit.Workspace.learn_csr` for how rows are turned into examples.
+
+        Args:
+            X: A CSR matrix, such as ``scipy.sparse.csr_matrix``, or any object with ``indptr``, ``indices``, ``data`` and ``shape`` attributes
+            namespaces: Optional namespace per column, either a string or a sequence of single characters. Defaults to the default namespace.
+
+        Returns:
+            numpy.ndarray: The scalar prediction for each row
+        """
+        return self._run_csr(X, None, None, namespaces, False)
+
+    def _run_csr(self, X, y, sample_weight, namespaces, learn: bool):
+        import numpy as np
+
+        # Integer indices of any width and float32 or float64 values are read as they are, only other types are
+        # converted.
+        indptr = np.ascontiguousarray(X.indptr)
+        if indptr.dtype.kind not in "iu":
+            indptr = indptr.astype(np.int64)
+        indices = np.ascontiguousarray(X.indices)
+        if indices.dtype.kind not in "iu":
+            indices = indices.astype(np.int64)
+        data = np.ascontiguousarray(X.data)
+        if data.dtype not in (np.float32, np.float64):
+            data = data.astype(np.float64)
+        num_rows = len(indptr) - 1
+
+        column_namespaces = None
+        if namespaces is not None:
+            column_namespaces = np.frombuffer(
+                "".join(namespaces).encode("ascii"), dtype=np.uint8
+            )
+            if len(column_namespaces) != X.shape[1]:
+                raise ValueError("Expecting one namespace per column of X")
+
+        labels = None if y is None else np.ascontiguousarray(y, dtype=np.float32)
+        weights = (
+            None
+            if sample_weight is None
+            else np.ascontiguousarray(sample_weight, dtype=np.float32)
+        )
+        predictions = np.empty(num_rows, dtype=np.float32)
+        pylibvw.vw._run_csr(
+            self,
+            indptr,
+            indices,
+            data,
+            column_namespaces,
+            labels,
+            weights,
+            predictions,
+            learn,
+        )
+        return predictions
+
     def save(self, filename: Union[str, Path]) -> None:
         """save model to disk"""
         pylibvw.vw.save(self, str(filename))
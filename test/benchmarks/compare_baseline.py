@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+"""Compare two vw-benchmarks.out runs saved with --benchmark_out_format=json.
+
+Exits with status 1 when a benchmark of the current run lost more than --throughput_threshold of the baseline's
+items per second, or when its p99_ns counter grew by more than --latency_threshold. Benchmarks present in only one
+of the two files are listed but do not fail the comparison.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load_runs(file_name):
+    with open(file_name) as f:
+        report = json.load(f)
+    runs = {}
+    for run in report["benchmarks"]:
+        # With --benchmark_repetitions compare the medians, otherwise the single iteration run.
+        if run.get("run_type") == "aggregate" and run.get("aggregate_name") != "median":
+            continue
+        runs[run.get("run_name", run["name"])] = run
+    return runs
+
+
+def relative_change(baseline, current):
+    return (current - baseline) / baseline if baseline else 0.0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline", help="JSON output of the baseline run")
+    parser.add_argument("current", help="JSON output of the run to check")
+    parser.add_argument("--throughput_threshold", type=float, default=0.1)
+    parser.add_argument("--latency_threshold", type=float, default=0.25)
+    args = parser.parse_args()
+
+    baseline = load_runs(args.baseline)
+    current = load_runs(args.current)
+
+    regressions = []
+    print("{:<70} {:>12} {:>12}".format("benchmark", "throughput", "p99"))
+    for name in sorted(set(baseline) & set(current)):
+        base_run, run = baseline[name], current[name]
+        throughput = relative_change(base_run.get("items_per_second", 0), run.get("items_per_second", 0))
+        p99 = relative_change(base_run.get("p99_ns", 0), run.get("p99_ns", 0))
+        regressed = throughput < -args.throughput_threshold or p99 > args.latency_threshold
+        print("{:<70} {:>+11.1%} {:>+11.1%}{}".format(name, throughput, p99, "  REGRESSION" if regressed else ""))
+        if regressed:
+            regressions.append(name)
+
+    for name in sorted(set(baseline) - set(current)):
+        print("{:<70} missing from the current run".format(name))
+    for name in sorted(set(current) - set(baseline)):
+        print("{:<70} not in the baseline".format(name))
+
+    if regressions:
+        print("\n{} benchmark(s) regressed".format(len(regressions)))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
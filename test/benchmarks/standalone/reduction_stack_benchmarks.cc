@@ -0,0 +1,309 @@
+#include "vw/config/options_cli.h"
+#include "vw/core/learner.h"
+#include "vw/core/parse_primitives.h"
+#include "vw/core/vw.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// End to end benchmarks of whole reduction stacks. Each iteration learns or predicts once on every example of a fixed
+// synthetic dataset. Besides throughput, every benchmark reports the p50 and p99 latency of a single learn or predict
+// call as the p50_ns and p99_ns counters. compare_baseline.py compares two runs saved as JSON, see README.md.
+
+namespace
+{
+// One entry per example, holding one line for a single line example and the lines of the group otherwise.
+using dataset = std::vector<std::vector<std::string>>;
+
+std::string gen_namespace(std::mt19937& rng, char ns, size_t feature_count, size_t vocabulary_size)
+{
+  std::ostringstream ss;
+  ss << " |" << ns;
+  for (size_t i = 0; i < feature_count; ++i) { ss << " f" << rng() % vocabulary_size << ":" << (rng() % 100) / 50.f; }
+  return ss.str();
+}
+
+std::string gen_namespaces(std::mt19937& rng, const std::string& namespaces, size_t feature_count)
+{
+  std::string features;
+  for (char ns : namespaces) { features += gen_namespace(rng, ns, feature_count, 1000); }
+  return features;
+}
+
+dataset gen_regression_examples(size_t num_examples, const std::string& namespaces, size_t feature_count)
+{
+  std::mt19937 rng(0);
+  dataset examples;
+  for (size_t i = 0; i < num_examples; ++i)
+  {
+    examples.push_back({std::to_string((rng() % 200) / 100.f - 1.f) + gen_namespaces(rng, namespaces, feature_count)});
+  }
+  return examples;
+}
+
+dataset gen_multiclass_examples(size_t num_examples, size_t num_classes)
+{
+  std::mt19937 rng(0);
+  dataset examples;
+  for (size_t i = 0; i < num_examples; ++i)
+  {
+    examples.push_back({std::to_string(1 + rng() % num_classes) + gen_namespaces(rng, "ab", 10)});
+  }
+  return examples;
+}
+
+dataset gen_multilabel_examples(size_t num_examples, size_t num_labels, size_t labels_per_example)
+{
+  std::mt19937 rng(0);
+  dataset examples;
+  for (size_t i = 0; i < num_examples; ++i)
+  {
+    std::string labels;
+    for (size_t j = 0; j < labels_per_example; ++j)
+    {
+      labels += (j == 0 ? "" : ",") + std::to_string(rng() % num_labels);
+    }
+    examples.push_back({labels + gen_namespaces(rng, "ab", 10)});
+  }
+  return examples;
+}
+
+dataset gen_continuous_action_examples(size_t num_examples, float min_value, float max_value)
+{
+  std::mt19937 rng(0);
+  std::uniform_real_distribution<float> action(min_value, max_value);
+  dataset examples;
+  for (size_t i = 0; i < num_examples; ++i)
+  {
+    std::ostringstream label;
+    label << "ca " << action(rng) << ":" << (rng() % 100) / 100.f << ":" << 1.f / (max_value - min_value);
+    examples.push_back({label.str() + gen_namespaces(rng, "ab", 10)});
+  }
+  return examples;
+}
+
+dataset gen_cb_adf_examples(size_t num_examples, size_t num_actions)
+{
+  std::mt19937 rng(0);
+  dataset examples;
+  for (size_t i = 0; i < num_examples; ++i)
+  {
+    std::vector<std::string> lines = {"shared" + gen_namespaces(rng, "s", 10)};
+    const size_t chosen = rng() % num_actions;
+    for (size_t a = 0; a < num_actions; ++a)
+    {
+      const std::string cost = rng() % 2 == 0 ? "0" : "-1";
+      const std::string label = a == chosen ? std::to_string(a) + ":" + cost + ":0.5" : "";
+      lines.push_back(label + gen_namespaces(rng, "ab", 5));
+    }
+    examples.push_back(lines);
+  }
+  return examples;
+}
+
+dataset gen_ccb_examples(size_t num_examples, size_t num_actions, size_t num_slots)
+{
+  std::mt19937 rng(0);
+  dataset examples;
+  for (size_t i = 0; i < num_examples; ++i)
+  {
+    std::vector<std::string> lines = {"ccb shared" + gen_namespaces(rng, "s", 10)};
+    for (size_t a = 0; a < num_actions; ++a) { lines.push_back("ccb action" + gen_namespaces(rng, "ab", 5)); }
+    for (size_t s = 0; s < num_slots; ++s)
+    {
+      const std::string cost = rng() % 2 == 0 ? "0" : "1";
+      lines.push_back(
+          "ccb slot " + std::to_string(rng() % num_actions) + ":" + cost + ":0.5" + gen_namespaces(rng, "c", 2));
+    }
+    examples.push_back(lines);
+  }
+  return examples;
+}
+
+dataset gen_cs_ldf_examples(size_t num_examples, size_t num_actions)
+{
+  std::mt19937 rng(0);
+  dataset examples;
+  for (size_t i = 0; i < num_examples; ++i)
+  {
+    std::vector<std::string> lines;
+    for (size_t a = 0; a < num_actions; ++a)
+    {
+      const std::string cost = std::to_string((rng() % 100) / 100.f);
+      lines.push_back(std::to_string(a + 1) + ":" + cost + gen_namespaces(rng, "ab", 5));
+    }
+    examples.push_back(lines);
+  }
+  return examples;
+}
+
+// Keeps the latest samples once full, so that long runs use bounded memory.
+class latency_samples
+{
+public:
+  void add(std::chrono::nanoseconds latency)
+  {
+    const auto ns = static_cast<double>(latency.count());
+    if (_samples.size() < MAX_SAMPLES) { _samples.push_back(ns); }
+    else { _samples[_next++ % MAX_SAMPLES] = ns; }
+  }
+
+  void report(benchmark::State& state)
+  {
+    if (_samples.empty()) { return; }
+    std::sort(_samples.begin(), _samples.end());
+    state.counters["p50_ns"] = _samples[_samples.size() / 2];
+    state.counters["p99_ns"] = _samples[std::min(_samples.size() - 1, _samples.size() * 99 / 100)];
+  }
+
+private:
+  static constexpr size_t MAX_SAMPLES = 1 << 20;
+  std::vector<double> _samples;
+  size_t _next = 0;
+};
+
+template <bool is_learn>
+void run(VW::workspace& vw, VW::multi_ex& examples, bool multiline)
+{
+  if (multiline)
+  {
+    if (is_learn) { vw.learn(examples); }
+    else { vw.predict(examples); }
+  }
+  else
+  {
+    if (is_learn) { vw.learn(*examples[0]); }
+    else { vw.predict(*examples[0]); }
+  }
+}
+
+template <bool is_learn>
+void bench_stack(benchmark::State& state, const dataset& data, const std::string& cmd)
+{
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(VW::split_command_line(cmd + " --quiet")));
+  const bool multiline = vw->l->is_multiline();
+
+  std::vector<VW::multi_ex> examples;
+  for (const auto& lines : data)
+  {
+    VW::multi_ex ex;
+    for (const auto& line : lines) { ex.push_back(VW::read_example(*vw, line)); }
+    examples.push_back(ex);
+  }
+
+  // Predict against a model that has seen the data, so that the predictions are not trivially zero.
+  if (!is_learn)
+  {
+    for (auto& ex : examples) { run<true>(*vw, ex, multiline); }
+  }
+
+  latency_samples latencies;
+  for (auto _ : state)
+  {
+    for (auto& ex : examples)
+    {
+      const auto start = std::chrono::steady_clock::now();
+      run<is_learn>(*vw, ex, multiline);
+      latencies.add(std::chrono::steady_clock::now() - start);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * examples.size()));
+  latencies.report(state);
+
+  for (auto& ex : examples)
+  {
+    if (multiline) { vw->finish_example(ex); }
+    else { vw->finish_example(*ex[0]); }
+  }
+}
+}  // namespace
+
+static void stack_learn(benchmark::State& state, const dataset& data, const std::string& cmd)
+{
+  bench_stack<true>(state, data, cmd);
+}
+
+static void stack_predict(benchmark::State& state, const dataset& data, const std::string& cmd)
+{
+  bench_stack<false>(state, data, cmd);
+}
+
+// gd with interactions
+BENCHMARK_CAPTURE(stack_learn, gd_quadratic, gen_regression_examples(200, "abc", 10), "-q ab");
+BENCHMARK_CAPTURE(stack_predict, gd_quadratic, gen_regression_examples(200, "abc", 10), "-q ab");
+BENCHMARK_CAPTURE(stack_learn, gd_cubic, gen_regression_examples(200, "abc", 10), "--cubic abc");
+BENCHMARK_CAPTURE(stack_predict, gd_cubic, gen_regression_examples(200, "abc", 10), "--cubic abc");
+BENCHMARK_CAPTURE(stack_learn, lrq, gen_regression_examples(200, "abc", 10), "--lrq ab4");
+BENCHMARK_CAPTURE(stack_predict, lrq, gen_regression_examples(200, "abc", 10), "--lrq ab4");
+
+// Multiclass and multilabel
+BENCHMARK_CAPTURE(stack_learn, oaa, gen_multiclass_examples(200, 20), "--oaa 20");
+BENCHMARK_CAPTURE(stack_predict, oaa, gen_multiclass_examples(200, 20), "--oaa 20");
+BENCHMARK_CAPTURE(stack_learn, csoaa_ldf, gen_cs_ldf_examples(100, 10), "--csoaa_ldf multiline");
+BENCHMARK_CAPTURE(stack_predict, csoaa_ldf, gen_cs_ldf_examples(100, 10), "--csoaa_ldf multiline");
+BENCHMARK_CAPTURE(stack_learn, plt, gen_multilabel_examples(200, 100, 3), "--plt 100 --loss_function logistic");
+BENCHMARK_CAPTURE(stack_predict, plt, gen_multilabel_examples(200, 100, 3), "--plt 100 --loss_function logistic");
+
+// Contextual bandits, one benchmark per explorer
+BENCHMARK_CAPTURE(stack_learn, cb_explore_adf_epsilon, gen_cb_adf_examples(100, 10), "--cb_explore_adf --epsilon 0.1");
+BENCHMARK_CAPTURE(
+    stack_predict, cb_explore_adf_epsilon, gen_cb_adf_examples(100, 10), "--cb_explore_adf --epsilon 0.1");
+BENCHMARK_CAPTURE(stack_learn, cb_explore_adf_first, gen_cb_adf_examples(100, 10), "--cb_explore_adf --first 2");
+BENCHMARK_CAPTURE(stack_predict, cb_explore_adf_first, gen_cb_adf_examples(100, 10), "--cb_explore_adf --first 2");
+BENCHMARK_CAPTURE(stack_learn, cb_explore_adf_bag, gen_cb_adf_examples(100, 10), "--cb_explore_adf --bag 5");
+BENCHMARK_CAPTURE(stack_predict, cb_explore_adf_bag, gen_cb_adf_examples(100, 10), "--cb_explore_adf --bag 5");
+BENCHMARK_CAPTURE(stack_learn, cb_explore_adf_cover, gen_cb_adf_examples(100, 10), "--cb_explore_adf --cover 3");
+BENCHMARK_CAPTURE(stack_predict, cb_explore_adf_cover, gen_cb_adf_examples(100, 10), "--cb_explore_adf --cover 3");
+BENCHMARK_CAPTURE(
+    stack_learn, cb_explore_adf_softmax, gen_cb_adf_examples(100, 10), "--cb_explore_adf --softmax --lambda 10");
+BENCHMARK_CAPTURE(
+    stack_predict, cb_explore_adf_softmax, gen_cb_adf_examples(100, 10), "--cb_explore_adf --softmax --lambda 10");
+BENCHMARK_CAPTURE(stack_learn, cb_explore_adf_regcb, gen_cb_adf_examples(100, 10), "--cb_explore_adf --regcb");
+BENCHMARK_CAPTURE(stack_predict, cb_explore_adf_regcb, gen_cb_adf_examples(100, 10), "--cb_explore_adf --regcb");
+BENCHMARK_CAPTURE(stack_learn, cb_explore_adf_squarecb, gen_cb_adf_examples(100, 10), "--cb_explore_adf --squarecb");
+BENCHMARK_CAPTURE(stack_predict, cb_explore_adf_squarecb, gen_cb_adf_examples(100, 10), "--cb_explore_adf --squarecb");
+BENCHMARK_CAPTURE(stack_learn, cb_explore_adf_rnd, gen_cb_adf_examples(100, 10), "--cb_explore_adf --rnd 3");
+BENCHMARK_CAPTURE(stack_predict, cb_explore_adf_rnd, gen_cb_adf_examples(100, 10), "--cb_explore_adf --rnd 3");
+BENCHMARK_CAPTURE(
+    stack_learn, cb_explore_adf_synthcover, gen_cb_adf_examples(100, 10), "--cb_explore_adf --synthcover");
+BENCHMARK_CAPTURE(
+    stack_predict, cb_explore_adf_synthcover, gen_cb_adf_examples(100, 10), "--cb_explore_adf --synthcover");
+BENCHMARK_CAPTURE(stack_learn, cb_explore_adf_large_action_space, gen_cb_adf_examples(20, 50),
+    "--cb_explore_adf --large_action_space --max_actions 5 -q sa");
+BENCHMARK_CAPTURE(stack_predict, cb_explore_adf_large_action_space, gen_cb_adf_examples(20, 50),
+    "--cb_explore_adf --large_action_space --max_actions 5 -q sa");
+BENCHMARK_CAPTURE(stack_learn, ccb_explore_adf, gen_ccb_examples(50, 10, 3), "--ccb_explore_adf -q sa");
+BENCHMARK_CAPTURE(stack_predict, ccb_explore_adf, gen_ccb_examples(50, 10, 3), "--ccb_explore_adf -q sa");
+BENCHMARK_CAPTURE(
+    stack_learn, automl, gen_cb_adf_examples(100, 10), "--cb_explore_adf --automl 4 --default_lease 10");
+BENCHMARK_CAPTURE(
+    stack_predict, automl, gen_cb_adf_examples(100, 10), "--cb_explore_adf --automl 4 --default_lease 10");
+
+// Continuous actions
+BENCHMARK_CAPTURE(stack_learn, cats, gen_continuous_action_examples(200, 0.f, 100.f),
+    "--cats 32 --bandwidth 5 --min_value 0 --max_value 100");
+BENCHMARK_CAPTURE(stack_predict, cats, gen_continuous_action_examples(200, 0.f, 100.f),
+    "--cats 32 --bandwidth 5 --min_value 0 --max_value 100");
+
+// Cost of --profile_hot_path: each pair runs the same stack with --extra_metrics, with and without profiling, so the
+// difference in throughput is the profiling overhead. The target is below 2%.
+BENCHMARK_CAPTURE(stack_learn, gd_quadratic_metrics, gen_regression_examples(200, "abc", 10),
+    "-q ab --extra_metrics profile_overhead_metrics.json");
+BENCHMARK_CAPTURE(stack_learn, gd_quadratic_profiled, gen_regression_examples(200, "abc", 10),
+    "-q ab --extra_metrics profile_overhead_metrics.json --profile_hot_path");
+BENCHMARK_CAPTURE(stack_predict, oaa_metrics, gen_multiclass_examples(200, 20),
+    "--oaa 20 --extra_metrics profile_overhead_metrics.json");
+BENCHMARK_CAPTURE(stack_predict, oaa_profiled, gen_multiclass_examples(200, 20),
+    "--oaa 20 --extra_metrics profile_overhead_metrics.json --profile_hot_path");
+BENCHMARK_CAPTURE(stack_learn, cb_explore_adf_bag_metrics, gen_cb_adf_examples(100, 10),
+    "--cb_explore_adf --bag 5 --extra_metrics profile_overhead_metrics.json");
+BENCHMARK_CAPTURE(stack_learn, cb_explore_adf_bag_profiled, gen_cb_adf_examples(100, 10),
+    "--cb_explore_adf --bag 5 --extra_metrics profile_overhead_metrics.json --profile_hot_path");
@@ -0,0 +1,62 @@
+#include "vw/core/array_parameters_dense.h"
+#include "vw/core/array_parameters_sparse.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Weight lookups at the access pattern of a linear model touching a small fraction of a large feature space.
+template <typename WeightsT>
+static void bench_weight_lookup(benchmark::State& state)
+{
+  const auto num_bits = static_cast<uint32_t>(state.range(0));
+  const auto num_touched = static_cast<size_t>(state.range(1));
+  constexpr uint32_t stride_shift = 2;
+
+  WeightsT weights(static_cast<uint64_t>(1) << num_bits, stride_shift);
+  std::mt19937_64 rng(42);
+  std::vector<uint64_t> indices(num_touched);
+  for (auto& index : indices) { index = rng() << stride_shift; }
+  for (auto index : indices) { weights[index] = 1.f; }
+
+  for (auto _ : state)
+  {
+    float sum = 0.f;
+    for (auto index : indices) { sum += weights[index]; }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * num_touched));
+}
+
+// Iterating all weights, as done by save_load, sync_weights and allreduce.
+template <typename WeightsT>
+static void bench_weight_iteration(benchmark::State& state)
+{
+  const auto num_bits = static_cast<uint32_t>(state.range(0));
+  const auto num_touched = static_cast<size_t>(state.range(1));
+  constexpr uint32_t stride_shift = 2;
+
+  WeightsT weights(static_cast<uint64_t>(1) << num_bits, stride_shift);
+  std::mt19937_64 rng(42);
+  for (size_t i = 0; i < num_touched; i++) { weights[rng() << stride_shift] = 1.f; }
+
+  for (auto _ : state)
+  {
+    float sum = 0.f;
+    for (auto& w : weights) { sum += w; }
+    benchmark::DoNotOptimize(sum);
+  }
+}
+
+BENCHMARK_TEMPLATE(bench_weight_lookup, VW::dense_parameters)->Args({18, 10000})->Args({24, 100000});
+BENCHMARK_TEMPLATE(bench_weight_lookup, VW::sparse_parameters)
+    ->Args({18, 10000})
+    ->Args({24, 100000})
+    ->Args({32, 100000});
+BENCHMARK_TEMPLATE(bench_weight_iteration, VW::dense_parameters)->Args({18, 10000})->Args({24, 100000});
+BENCHMARK_TEMPLATE(bench_weight_iteration, VW::sparse_parameters)
+    ->Args({18, 10000})
+    ->Args({24, 100000})
+    ->Args({32, 100000});
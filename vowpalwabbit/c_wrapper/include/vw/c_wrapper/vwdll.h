@@ -117,6 +117,25 @@ extern "C"
   VW_DLL_PUBLIC float VW_CALLING_CONV VW_Learn(VW_HANDLE handle, VW_EXAMPLE e);
   VW_DLL_PUBLIC float VW_CALLING_CONV VW_Predict(VW_HANDLE handle, VW_EXAMPLE e);
   VW_DLL_PUBLIC float VW_CALLING_CONV VW_PredictCostSensitive(VW_HANDLE handle, VW_EXAMPLE e);
+
+  // Batched versions of read/learn/finish and read/predict/finish. Each call processes count examples, one after the
+  // other, and writes the scalar prediction of example i to predictions[i] (predictions may be null when learning).
+  // Text examples are packed back to back: example i is lines[line_offsets[i], line_offsets[i + 1]), so line_offsets
+  // holds count + 1 entries and the lines need not be null terminated. Both return 0, or -1 without processing any
+  // example when the reduction stack is not a single line learner with scalar predictions.
+  VW_DLL_PUBLIC int VW_CALLING_CONV VW_LearnBatchA(
+      VW_HANDLE handle, const char* lines, const size_t* line_offsets, size_t count, float* predictions);
+  VW_DLL_PUBLIC int VW_CALLING_CONV VW_PredictBatchA(
+      VW_HANDLE handle, const char* lines, const size_t* line_offsets, size_t count, float* predictions);
+  // Pre-hashed examples in compressed sparse row form, all features in the default namespace: example i has the
+  // features feature_indices/feature_values[feature_offsets[i], feature_offsets[i + 1]). Learning takes simple labels
+  // and importance weights (weights may be null for 1). Both return 0, or -1 as the text batches do, and also when
+  // learning with a reduction stack that does not take simple labels.
+  VW_DLL_PUBLIC int VW_CALLING_CONV VW_LearnHashedBatch(VW_HANDLE handle, const float* labels, const float* weights,
+      const size_t* feature_offsets, const size_t* feature_indices, const float* feature_values, size_t count,
+      float* predictions);
+  VW_DLL_PUBLIC int VW_CALLING_CONV VW_PredictHashedBatch(VW_HANDLE handle, const size_t* feature_offsets,
+      const size_t* feature_indices, const float* feature_values, size_t count, float* predictions);
   // deprecated. Please use either VW_ReadExample for parsing, or VW_ImportExample for example construction
   VW_DLL_PUBLIC void VW_CALLING_CONV VW_AddLabel(VW_EXAMPLE e, float label, float weight, float base);
   // deprecated. Please use either VW_ReadExample for parsing, or VW_ImportExample for example construction
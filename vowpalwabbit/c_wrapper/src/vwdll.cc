@@ -14,6 +14,7 @@
 #include "vw/core/simple_label.h"
 #include "vw/core/vw.h"
 #include "vw/io/io_adapter.h"
+#include "vw/text_parser/parse_example_text.h"
 
 #include <codecvt>
 #include <locale>
@@ -49,6 +50,53 @@ std::string utf16_to_utf8(const std::u16string& utf16_string)
 }
 #endif
 
+namespace
+{
+void import_hashed_features(VW::example& ex, const size_t* feature_offsets, const size_t* feature_indices,
+    const float* feature_values, size_t i)
+{
+  auto& fs = ex.feature_space[VW::details::DEFAULT_NAMESPACE];
+  const size_t begin = feature_offsets[i];
+  const size_t end = feature_offsets[i + 1];
+  for (size_t j = begin; j < end; j++) { fs.push_back(feature_values[j], feature_indices[j]); }
+  if (!fs.empty()) { ex.indices.push_back(VW::details::DEFAULT_NAMESPACE); }
+}
+
+// Batches build single examples and read back scalar predictions.
+bool takes_batches(VW::workspace& all)
+{
+  return !all.l->is_multiline() && all.l->get_output_prediction_type() == VW::prediction_type_t::SCALAR;
+}
+
+// Hashed batches also write simple labels when learning.
+bool takes_hashed_batches(VW::workspace& all, bool learn)
+{
+  return takes_batches(all) && (!learn || all.example_parser->lbl_parser.label_type == VW::label_type_t::SIMPLE);
+}
+
+// Learns or predicts one set up example and returns it to the pool.
+void run_and_finish(VW::workspace& all, VW::example& ex, bool learn, float* predictions, size_t i)
+{
+  if (learn) { all.learn(ex); }
+  else { VW::LEARNER::as_singleline(all.l)->predict(ex); }
+  if (predictions != nullptr) { predictions[i] = VW::get_prediction(&ex); }
+  VW::finish_example(all, ex);
+}
+
+void run_text_batch(VW::workspace& all, const char* lines, const size_t* line_offsets, size_t count, bool learn,
+    float* predictions)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    auto& ex = VW::get_unused_example(&all);
+    VW::parsers::text::read_line(
+        all, &ex, VW::string_view(lines + line_offsets[i], line_offsets[i + 1] - line_offsets[i]));
+    VW::setup_example(all, &ex);
+    run_and_finish(all, ex, learn, predictions, i);
+  }
+}
+}  // namespace
+
 extern "C"
 {
 #ifdef USE_CODECVT
@@ -370,6 +418,59 @@ extern "C"
     return VW::get_cost_sensitive_prediction(ex);
   }
 
+  VW_DLL_PUBLIC int VW_CALLING_CONV VW_LearnBatchA(
+      VW_HANDLE handle, const char* lines, const size_t* line_offsets, size_t count, float* predictions)
+  {
+    auto* pointer = static_cast<VW::workspace*>(handle);
+    if (!takes_batches(*pointer)) { return -1; }
+    run_text_batch(*pointer, lines, line_offsets, count, true, predictions);
+    return 0;
+  }
+
+  VW_DLL_PUBLIC int VW_CALLING_CONV VW_PredictBatchA(
+      VW_HANDLE handle, const char* lines, const size_t* line_offsets, size_t count, float* predictions)
+  {
+    auto* pointer = static_cast<VW::workspace*>(handle);
+    if (!takes_batches(*pointer)) { return -1; }
+    run_text_batch(*pointer, lines, line_offsets, count, false, predictions);
+    return 0;
+  }
+
+  VW_DLL_PUBLIC int VW_CALLING_CONV VW_LearnHashedBatch(VW_HANDLE handle, const float* labels, const float* weights,
+      const size_t* feature_offsets, const size_t* feature_indices, const float* feature_values, size_t count,
+      float* predictions)
+  {
+    auto* pointer = static_cast<VW::workspace*>(handle);
+    if (!takes_hashed_batches(*pointer, true)) { return -1; }
+    for (size_t i = 0; i < count; i++)
+    {
+      auto* ex = VW::new_unused_example(*pointer);
+      // Importance weights live in the label's reduction features, setup_example copies them to ex->weight.
+      ex->l.simple.label = labels[i];
+      ex->ex_reduction_features.template get<VW::simple_label_reduction_features>().weight =
+          weights == nullptr ? 1.f : weights[i];
+      import_hashed_features(*ex, feature_offsets, feature_indices, feature_values, i);
+      VW::setup_example(*pointer, ex);
+      run_and_finish(*pointer, *ex, true, predictions, i);
+    }
+    return 0;
+  }
+
+  VW_DLL_PUBLIC int VW_CALLING_CONV VW_PredictHashedBatch(VW_HANDLE handle, const size_t* feature_offsets,
+      const size_t* feature_indices, const float* feature_values, size_t count, float* predictions)
+  {
+    auto* pointer = static_cast<VW::workspace*>(handle);
+    if (!takes_hashed_batches(*pointer, false)) { return -1; }
+    for (size_t i = 0; i < count; i++)
+    {
+      auto* ex = VW::new_unused_example(*pointer);
+      import_hashed_features(*ex, feature_offsets, feature_indices, feature_values, i);
+      VW::setup_example(*pointer, ex);
+      run_and_finish(*pointer, *ex, false, predictions, i);
+    }
+    return 0;
+  }
+
   VW_DLL_PUBLIC float VW_CALLING_CONV VW_Get_Weight(VW_HANDLE handle, size_t index, size_t offset)
   {
     auto* pointer = static_cast<VW::workspace*>(handle);
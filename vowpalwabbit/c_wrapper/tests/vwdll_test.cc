@@ -10,6 +10,10 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <sstream>
+#include <string>
+#include <vector>
+
 using namespace ::testing;
 
 template <class T>
@@ -115,3 +119,128 @@ TEST(Vwdll, ParseEscaped)
   VW_Finish(handle1);
 }
 #endif
+
+TEST(Vwdll, TextBatchMatchesPerExampleCalls)
+{
+  const std::vector<std::string> lines = {"1 |a x y:2", "-1 |a z |b w", "0.5 |b x:0.5 v"};
+
+  VW_HANDLE single = VW_InitializeA("--quiet");
+  std::vector<float> single_predictions;
+  for (const auto& line : lines)
+  {
+    auto example = VW_ReadExampleA(single, line.c_str());
+    single_predictions.push_back(VW_Learn(single, example));
+    VW_FinishExample(single, example);
+  }
+
+  std::string packed;
+  std::vector<size_t> offsets = {0};
+  for (const auto& line : lines)
+  {
+    packed += line;
+    offsets.push_back(packed.size());
+  }
+  VW_HANDLE batched = VW_InitializeA("--quiet");
+  std::vector<float> batch_predictions(lines.size());
+  EXPECT_EQ(VW_LearnBatchA(batched, packed.data(), offsets.data(), lines.size(), batch_predictions.data()), 0);
+  EXPECT_THAT(batch_predictions, Pointwise(FloatEq(), single_predictions));
+
+  auto vw1 = static_cast<VW::workspace*>(single);
+  auto vw2 = static_cast<VW::workspace*>(batched);
+  check_weights_equal(vw1->weights.dense_weights, vw2->weights.dense_weights);
+
+  std::vector<float> predict_predictions(lines.size());
+  EXPECT_EQ(VW_PredictBatchA(batched, packed.data(), offsets.data(), lines.size(), predict_predictions.data()), 0);
+  for (size_t i = 0; i < lines.size(); i++)
+  {
+    auto example = VW_ReadExampleA(single, lines[i].c_str());
+    EXPECT_FLOAT_EQ(predict_predictions[i], VW_Predict(single, example));
+    VW_FinishExample(single, example);
+  }
+
+  VW_Finish(single);
+  VW_Finish(batched);
+}
+
+TEST(Vwdll, HashedBatchMatchesImportedExamples)
+{
+  const std::vector<float> labels = {1.f, -1.f};
+  const std::vector<float> weights = {1.f, 2.f};
+  const std::vector<size_t> offsets = {0, 2, 3};
+  const std::vector<size_t> indices = {10, 20, 30};
+  const std::vector<float> values = {1.f, 0.5f, 2.f};
+
+  VW_HANDLE imported = VW_InitializeA("--noconstant --quiet");
+  auto import_example = [&](size_t i, const std::string& label)
+  {
+    auto fs = VW_InitializeFeatureSpaces(1);
+    auto space = VW_GetFeatureSpace(fs, 0);
+    VW_InitFeatures(space, offsets[i + 1] - offsets[i]);
+    VW_SetFeatureSpace(imported, space, " ");
+    for (size_t j = offsets[i]; j < offsets[i + 1]; j++)
+    {
+      VW_SetFeature(space, j - offsets[i], indices[j], values[j]);
+    }
+    auto example = VW_ImportExample(imported, label.c_str(), fs, 1);
+    VW_ReleaseFeatureSpace(fs, 1);
+    return example;
+  };
+
+  std::vector<float> imported_predictions;
+  for (size_t i = 0; i < labels.size(); i++)
+  {
+    // std::to_string writes six decimals, which the text label parser does not always read back exactly.
+    std::ostringstream label;
+    label << labels[i] << " " << weights[i];
+    auto example = import_example(i, label.str());
+    imported_predictions.push_back(VW_Learn(imported, example));
+    VW_FinishExample(imported, example);
+  }
+
+  VW_HANDLE batched = VW_InitializeA("--noconstant --quiet");
+  std::vector<float> batch_predictions(labels.size());
+  EXPECT_EQ(VW_LearnHashedBatch(batched, labels.data(), weights.data(), offsets.data(), indices.data(),
+                values.data(), labels.size(), batch_predictions.data()),
+      0);
+  EXPECT_THAT(batch_predictions, Pointwise(FloatEq(), imported_predictions));
+
+  auto vw1 = static_cast<VW::workspace*>(imported);
+  auto vw2 = static_cast<VW::workspace*>(batched);
+  check_weights_equal(vw1->weights.dense_weights, vw2->weights.dense_weights);
+
+  std::vector<float> predictions(labels.size());
+  EXPECT_EQ(
+      VW_PredictHashedBatch(batched, offsets.data(), indices.data(), values.data(), labels.size(), predictions.data()),
+      0);
+  for (size_t i = 0; i < labels.size(); i++)
+  {
+    auto example = import_example(i, "");
+    EXPECT_FLOAT_EQ(predictions[i], VW_Predict(imported, example));
+    VW_FinishExample(imported, example);
+  }
+  EXPECT_NE(predictions[0], 0.f);
+
+  VW_Finish(imported);
+  VW_Finish(batched);
+}
+
+TEST(Vwdll, BatchesRejectOtherStacks)
+{
+  const std::string line = "1 |a x";
+  const std::vector<size_t> line_offsets = {0, line.size()};
+  const std::vector<float> labels = {1.f};
+  const std::vector<size_t> offsets = {0, 1};
+  const std::vector<size_t> indices = {10};
+  const std::vector<float> values = {1.f};
+  std::vector<float> predictions(1);
+
+  VW_HANDLE multiclass = VW_InitializeA("--oaa 3 --quiet");
+  EXPECT_EQ(VW_LearnHashedBatch(multiclass, labels.data(), nullptr, offsets.data(), indices.data(), values.data(), 1,
+                predictions.data()),
+      -1);
+  EXPECT_EQ(
+      VW_PredictHashedBatch(multiclass, offsets.data(), indices.data(), values.data(), 1, predictions.data()), -1);
+  EXPECT_EQ(VW_LearnBatchA(multiclass, line.data(), line_offsets.data(), 1, predictions.data()), -1);
+  EXPECT_EQ(VW_PredictBatchA(multiclass, line.data(), line_offsets.data(), 1, predictions.data()), -1);
+  VW_Finish(multiclass);
+}
@@ -227,12 +227,16 @@ int VW::parsers::cache::read_example_from_cache(VW::workspace* all, io_buf& inpu
 
   // read indices
   auto num_indices = input.read_value_and_accumulate_size<unsigned char>("num_indices", total);
+  // The example is sorted only if every namespace is.
+  examples[0]->sorted = true;
   for (; num_indices > 0; num_indices--)
   {
     unsigned char index = 0;
     total += details::read_cached_index(input, index);
     examples[0]->indices.push_back(static_cast<size_t>(index));
-    total += details::read_cached_features(input, examples[0]->feature_space[index], examples[0]->sorted);
+    bool namespace_sorted = true;
+    total += details::read_cached_features(input, examples[0]->feature_space[index], namespace_sorted);
+    examples[0]->sorted = examples[0]->sorted && namespace_sorted;
   }
 
   return static_cast<int>(total);
@@ -13,6 +13,10 @@
 #include "vw/io/logger.h"
 
 #include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
 
 using namespace VW::config;
 
@@ -23,13 +27,25 @@ std::unique_ptr<VW::workspace> setup(std::unique_ptr<options_i> options)
   return all;
 }
 
+// Learners of --multi_config report concurrently, each line they write is tagged with the configuration it came from.
+void multi_config_trace(void* context, const std::string& message)
+{
+  static std::mutex output_lock;
+  std::lock_guard<std::mutex> lock(output_lock);
+  std::cerr << "[config " << *static_cast<const size_t*>(context) << "] " << message;
+}
+
 int main(int argc, char* argv[])
 {
   bool should_use_onethread = false;
   std::string log_level;
   std::string log_output_stream;
+  std::string multi_config_file;
   option_group_definition driver_config("Driver");
   driver_config.add(make_option("onethread", should_use_onethread).help("Disable parse thread"));
+  driver_config.add(make_option("multi_config", multi_config_file)
+                        .help("Train one more learner for each line of this file, which holds that learner's options. "
+                              "Examples are parsed once and each learner trains on its own thread"));
   driver_config.add(make_option("log_level", log_level)
                         .default_value("info")
                         .hidden()
@@ -84,6 +100,29 @@ int main(int argc, char* argv[])
       alls.push_back(setup(std::move(ptr)));
     }
 
+    // The trace contexts must outlive the workspaces using them.
+    std::vector<std::unique_ptr<size_t>> multi_config_indices;
+    if (!multi_config_file.empty())
+    {
+      if (should_use_onethread) { THROW("--multi_config cannot be used with --onethread"); }
+      std::ifstream config_file(multi_config_file);
+      if (!config_file) { THROW("Could not open file: " << multi_config_file); }
+
+      std::string line;
+      while (std::getline(config_file, line))
+      {
+        if (line.empty()) { continue; }
+        multi_config_indices.push_back(VW::make_unique<size_t>(alls.size()));
+        auto args = VW::split_command_line(line);
+        args.emplace_back("--no_stdin");  // examples come from the first learner's parser
+        auto ptr = VW::make_unique<options_cli>(args);
+        auto extra =
+            VW::initialize(std::move(ptr), nullptr, &multi_config_trace, multi_config_indices.back().get());
+        VW::LEARNER::check_multi_config_compatible(*alls[0], *extra, alls.size());
+        alls.push_back(std::move(extra));
+      }
+    }
+
     VW::workspace& all = *alls[0];
 
     auto skip_driver = all.options->get_typed_option<bool>("dry_run").value();
@@ -110,7 +149,8 @@ int main(int argc, char* argv[])
         std::vector<VW::workspace*> alls_ptrs;
         alls_ptrs.reserve(alls.size());
         for (auto& v : alls) { alls_ptrs.push_back(v.get()); }
-        VW::LEARNER::generic_driver(alls_ptrs);
+        if (multi_config_file.empty()) { VW::LEARNER::generic_driver(alls_ptrs); }
+        else { VW::LEARNER::generic_driver_parallel(alls_ptrs); }
       }
       VW::end_parser(all);
     }
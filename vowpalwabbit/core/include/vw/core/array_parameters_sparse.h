@@ -9,16 +9,24 @@
 #include "vw/core/constant.h"
 
 #include <cstddef>
+#include <cstdint>
 #include <functional>
-#include <unordered_map>
+#include <iterator>
+#include <vector>
+
 namespace VW
 {
 
 class sparse_parameters;
 namespace details
 {
-
-using weight_map = std::unordered_map<uint64_t, VW::weight*>;
+// One slot of the open addressing table in sparse_parameters. Slots without a block are empty.
+class sparse_slot
+{
+public:
+  uint64_t index = 0;
+  VW::weight* block = nullptr;  // stride() weights for this index
+};
 
 template <typename T>
 class sparse_iterator
@@ -30,28 +38,35 @@ public:
   using pointer = T*;
   using reference = T&;
 
-  sparse_iterator(weight_map::iterator iter) : _iter(iter) {}
+  sparse_iterator(sparse_slot* current, sparse_slot* end) : _current(current), _end(end) { skip_empty(); }
 
   sparse_iterator& operator=(const sparse_iterator& other) = default;
   sparse_iterator(const sparse_iterator& other) = default;
   sparse_iterator& operator=(sparse_iterator&& other) noexcept = default;
   sparse_iterator(sparse_iterator&& other) noexcept = default;
 
-  uint64_t index() { return _iter->first; }
+  uint64_t index() { return _current->index; }
 
-  T& operator*() { return *(_iter->second); }
+  T& operator*() { return *(_current->block); }
 
   sparse_iterator& operator++()
   {
-    _iter++;
+    ++_current;
+    skip_empty();
     return *this;
   }
 
-  bool operator==(const sparse_iterator& rhs) const { return _iter == rhs._iter; }
-  bool operator!=(const sparse_iterator& rhs) const { return _iter != rhs._iter; }
+  bool operator==(const sparse_iterator& rhs) const { return _current == rhs._current; }
+  bool operator!=(const sparse_iterator& rhs) const { return _current != rhs._current; }
 
 private:
-  weight_map::iterator _iter;
+  void skip_empty()
+  {
+    while (_current != _end && _current->block == nullptr) { ++_current; }
+  }
+
+  sparse_slot* _current;
+  sparse_slot* _end;
 };
 }  // namespace details
 class sparse_parameters
@@ -69,16 +84,22 @@ public:
   sparse_parameters& operator=(sparse_parameters&&) noexcept = delete;
   sparse_parameters(sparse_parameters&&) noexcept = delete;
 
-  bool not_null() { return (_weight_mask > 0 && !_map.empty()); }
+  bool not_null() { return (_weight_mask > 0 && _size > 0); }
   VW::weight* first() { THROW_OR_RETURN("Allreduce currently not supported in sparse", nullptr); }
 
-  // iterator with stride
-  iterator begin() { return iterator(_map.begin()); }
-  iterator end() { return iterator(_map.begin()); }
+  // iterator with stride, visits the weights that were touched in table order
+  iterator begin() { return iterator(_slots.data(), _slots.data() + _slots.size()); }
+  iterator end() { return iterator(_slots.data() + _slots.size(), _slots.data() + _slots.size()); }
 
   // const iterator
-  const_iterator cbegin() const { return const_iterator(_map.begin()); }
-  const_iterator cend() const { return const_iterator(_map.begin()); }
+  const_iterator cbegin() const { return const_iterator(_slots.data(), _slots.data() + _slots.size()); }
+  const_iterator cend() const
+  {
+    return const_iterator(_slots.data() + _slots.size(), _slots.data() + _slots.size());
+  }
+
+  // number of indices that have been touched
+  size_t size() const { return _size; }
 
   inline VW::weight& operator[](size_t i) { return *(get_or_default_and_get(i)); }
 
@@ -111,17 +132,25 @@ public:
 #endif
 
 private:
-  // This must be mutable because the const operator[] must be able to intialize default weights to return.
-  mutable details::weight_map _map;
-  uint64_t _weight_mask;  // (stride*(1 << num_bits) -1)
+  // Open addressing table with linear probing, its size is a power of 2. Blocks are carved out of slabs owned by
+  // this instance, so growing the table never moves weights.
+  // These must be mutable because the const operator[] must be able to intialize default weights to return.
+  mutable std::vector<details::sparse_slot> _slots;
+  mutable size_t _size;
+  mutable std::vector<VW::weight*> _slabs;
+  mutable VW::weight* _slab_next;  // first unused weight of _slabs.back()
+  mutable size_t _slab_remaining;
+  uint64_t _weight_mask;           // (stride*(1 << num_bits) -1)
   uint32_t _stride_shift;
   bool _seeded;  // whether the instance is sharing model state with others
-  bool _delete;
   std::function<void(VW::weight*, uint64_t)> _default_func;
 
   // It is marked const so it can be used from both const and non const operator[]
-  // The map itself is mutable to facilitate this
+  // The table itself is mutable to facilitate this
   VW::weight* get_or_default_and_get(size_t i) const;
+  VW::weight* allocate_block() const;
+  void grow() const;
+  void free_slabs();
 };
 }  // namespace VW
 using sparse_parameters VW_DEPRECATED("sparse_parameters moved into VW namespace") = VW::sparse_parameters;
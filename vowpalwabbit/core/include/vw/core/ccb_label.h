@@ -54,6 +54,13 @@ public:
   VW_ATTR(nodiscard) bool is_test_label() const;
   VW_ATTR(nodiscard) bool is_labeled() const;
   void reset_to_default();
+
+  // Sets outcome to an empty outcome and returns it. The outcome released by the last reset_to_default is reused, so
+  // a pooled example only allocates one the first time it carries a labeled slot.
+  ccb_outcome& emplace_outcome();
+
+private:
+  ccb_outcome* _released_outcome = nullptr;
 };
 
 void parse_ccb_label(ccb_label& ld, VW::label_parser_reuse_mem& reuse_mem, const std::vector<VW::string_view>& words,
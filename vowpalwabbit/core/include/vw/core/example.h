@@ -28,6 +28,10 @@
 namespace VW
 {
 class workspace;
+namespace details
+{
+class example_replay_buffer;
+}
 }
 namespace VW
 {
@@ -134,6 +138,7 @@ public:
 
   friend void VW::copy_example_data(example* dst, const example* src);
   friend void VW::setup_example(VW::workspace& all, example* ae);
+  friend class VW::details::example_replay_buffer;
 
 private:
   bool _total_sum_feat_sq_calculated = false;
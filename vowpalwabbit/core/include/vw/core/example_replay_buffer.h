@@ -0,0 +1,98 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include "vw/common/random.h"
+#include "vw/core/feature_group.h"
+#include "vw/core/io_buf.h"
+#include "vw/core/multi_ex.h"
+#include "vw/core/vw_fwd.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace VW
+{
+namespace details
+{
+// Holds the examples of the first pass in their set-up form (hashed, sorted, offsets multiplied, constant added) so
+// that later passes replay them without touching the input or re-running setup_example. Only the active namespaces of
+// each example are kept.
+//
+// The buffer is an arena: the features of all examples share one array of values and one of indices, and each
+// example keeps the end offsets of its part of them. Labels are kept in the compact form the label parser writes to
+// cache files, so a buffer of simple examples does not pay for the full polylabel of every example.
+class example_replay_buffer
+{
+public:
+  example_replay_buffer(bool shuffle, uint64_t seed);
+
+  // True once the first pass has been recorded and examples are being served from memory.
+  bool replaying() const { return _replaying; }
+  size_t size() const { return _examples.size(); }
+
+  // Copy a batch of examples that has just gone through setup_examples. A batch that does not end a
+  // multiline group is merged with the next one so that shuffling never splits a group.
+  void record(VW::label_parser& lbl_parser, const VW::multi_ex& examples, bool ends_record);
+
+  // Called at the end of every pass: stops recording and, when shuffling, draws the next pass's order.
+  void start_pass();
+
+  // Fill examples with the next recorded batch. examples must hold one unused example on entry, more are taken from
+  // the pool as needed. Returns false when the pass is exhausted.
+  bool replay_next(VW::workspace& all, VW::multi_ex& examples);
+
+private:
+  // Every range below starts where the previous example's or namespace's ends.
+  class stored_namespace
+  {
+  public:
+    VW::namespace_index index;
+    float sum_feat_sq;
+    size_t features_end;
+    size_t space_names_end;
+    size_t extents_end;
+  };
+
+  class stored_example
+  {
+  public:
+    size_t label_end;
+    size_t tag_end;
+    size_t namespaces_end;
+    size_t num_features;
+    float weight;
+    bool test_only;
+    bool is_newline;
+    bool sorted;
+  };
+
+  std::vector<stored_example> _examples;
+  std::vector<stored_namespace> _namespaces;
+  std::vector<VW::feature_value> _values;
+  std::vector<VW::feature_index> _indices;
+  // Only filled for namespaces that carry audit strings.
+  std::vector<VW::audit_strings> _space_names;
+  std::vector<VW::namespace_extent> _extents;
+  std::vector<char> _tags;
+
+  // Labels are written through _label_writer into _labels while recording. The first call to start_pass hands the
+  // bytes over to _label_reader, which reads each label in place.
+  std::shared_ptr<std::vector<char>> _labels;
+  VW::io_buf _label_writer;
+  VW::io_buf _label_reader;
+
+  // Record i covers _examples[_record_starts[i], _record_starts[i + 1]).
+  std::vector<size_t> _record_starts;
+  std::vector<size_t> _order;
+  size_t _next_record = 0;
+  bool _record_open = false;
+  bool _replaying = false;
+  bool _shuffle = false;
+  VW::rand_state _random_state;
+};
+}  // namespace details
+}  // namespace VW
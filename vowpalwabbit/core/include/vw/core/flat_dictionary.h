@@ -0,0 +1,62 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include "vw/common/string_view.h"
+#include "vw/core/feature_group.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace VW
+{
+namespace details
+{
+using feature_dict = std::unordered_map<std::string, std::unique_ptr<VW::features>>;
+
+// A dictionary entry points straight into the mapped file.
+class flat_dictionary_entry
+{
+public:
+  const feature_index* indices = nullptr;
+  const feature_value* values = nullptr;
+  size_t size = 0;
+  float sum_feat_sq = 0.f;
+};
+
+// Read-only, memory mapped form of a --dictionary file. Words are located with a perfect hash (hash and displace)
+// computed when the file is written, and the features of all entries are stored in two flat arrays, so lookups do not
+// allocate and expansion is a bulk copy. Files are written in native byte order.
+//
+// A mapped file is shared by every workspace in the process that loads the same path, and the page cache shares it
+// between processes.
+class flat_dictionary
+{
+public:
+  flat_dictionary(const flat_dictionary&) = delete;
+  flat_dictionary& operator=(const flat_dictionary&) = delete;
+  ~flat_dictionary();
+
+  static std::shared_ptr<const flat_dictionary> load(const std::string& file_name);
+  static void save(const feature_dict& dict, uint32_t hash_seed, const std::string& file_name);
+  static bool is_flat_dictionary_file(const std::string& file_name);
+
+  bool find(VW::string_view word, flat_dictionary_entry& entry) const;
+  size_t size() const;
+  // The features were hashed with this seed, it must match the workspace using the dictionary.
+  uint32_t hash_seed() const;
+
+private:
+  flat_dictionary() = default;
+
+  const char* _data = nullptr;
+  size_t _length = 0;
+  bool _mapped = false;
+  std::unique_ptr<char[]> _owned;
+};
+}  // namespace details
+}  // namespace VW
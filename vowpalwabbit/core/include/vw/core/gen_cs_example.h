@@ -261,6 +261,9 @@ void gen_cs_example(cb_to_cs_adf& c, VW::multi_ex& ec_seq, VW::cs_label& cs_labe
 
 void cs_prep_labels(VW::multi_ex& examples, std::vector<VW::cb_label>& cb_labels, VW::cs_label& cs_labels,
     std::vector<VW::cs_label>& prepped_cs_labels, uint64_t offset);
+// Undoes cs_prep_labels: puts back the cb labels and offsets, and keeps the cs labels for the next call.
+void cs_restore_labels(VW::multi_ex& examples, std::vector<VW::cb_label>& cb_labels,
+    std::vector<VW::cs_label>& prepped_cs_labels, uint64_t saved_offset);
 
 template <bool is_learn>
 void cs_ldf_learn_or_predict(VW::LEARNER::multi_learner& base, VW::multi_ex& examples,
@@ -277,20 +280,9 @@ void cs_ldf_learn_or_predict(VW::LEARNER::multi_learner& base, VW::multi_ex& exa
   uint64_t saved_offset = examples[0]->ft_offset;
 
   // Guard example state restore against throws
-  auto restore_guard = VW::scope_exit(
-      [&cb_labels, &prepped_cs_labels, saved_offset, &examples]
-      {
-        // 3rd: restore cb_label for each example
-        // (**ec).l.cb = array.element.
-        // and restore offsets
-        for (size_t i = 0; i < examples.size(); ++i)
-        {
-          prepped_cs_labels[i] = std::move(examples[i]->l.cs);
-          examples[i]->l.cs.costs.clear();
-          examples[i]->l.cb = std::move(cb_labels[i]);
-          examples[i]->ft_offset = saved_offset;
-        }
-      });
+  // 3rd: restore cb_label for each example and restore offsets
+  auto restore_guard = VW::scope_exit([&cb_labels, &prepped_cs_labels, saved_offset, &examples]
+      { cs_restore_labels(examples, cb_labels, prepped_cs_labels, saved_offset); });
 
   if (is_learn)
   {
@@ -300,5 +292,21 @@ void cs_ldf_learn_or_predict(VW::LEARNER::multi_learner& base, VW::multi_ex& exa
   else { base.predict(examples, static_cast<int32_t>(id)); }
 }
 
+// Predicts with the `count` consecutive models starting at `lo` in a single call into the cs_ldf learner, so that
+// reductions which support it walk the features of each action only once. pred[i] receives the prediction of model
+// lo + i.
+inline void cs_ldf_multipredict(VW::LEARNER::multi_learner& base, VW::multi_ex& examples,
+    std::vector<VW::cb_label>& cb_labels, VW::cs_label& cs_labels, std::vector<VW::cs_label>& prepped_cs_labels,
+    uint64_t offset, size_t lo, size_t count, VW::polyprediction* pred)
+{
+  cs_prep_labels(examples, cb_labels, cs_labels, prepped_cs_labels, offset);
+
+  uint64_t saved_offset = examples[0]->ft_offset;
+  auto restore_guard = VW::scope_exit([&cb_labels, &prepped_cs_labels, saved_offset, &examples]
+      { cs_restore_labels(examples, cb_labels, prepped_cs_labels, saved_offset); });
+
+  base.multipredict(examples, lo, count, pred, true);
+}
+
 }  // namespace details
 }  // namespace VW
@@ -9,6 +9,7 @@
 #include "vw/core/array_parameters.h"
 #include "vw/core/constant.h"
 #include "vw/core/error_reporting.h"
+#include "vw/core/flat_dictionary.h"
 #include "vw/core/input_parser.h"
 #include "vw/core/interaction_generation_state.h"
 #include "vw/core/metrics_collector.h"
@@ -44,7 +45,6 @@ namespace VW
 {
 namespace details
 {
-using feature_dict = std::unordered_map<std::string, std::unique_ptr<VW::features>>;
 class dictionary_info
 {
 public:
@@ -227,6 +227,7 @@ public:
       affix_features;  // affixes to generate (up to 16 per namespace - 4 bits per affix)
   std::array<bool, NUM_NAMESPACES> spelling_features;  // generate spelling features for which namespace
   std::vector<std::string> dictionary_path;            // where to look for dictionaries
+  bool save_flat_dictionaries = false;                 // write loaded text dictionaries as flat dictionaries
 
   // feature_dict can be created in either loaded_dictionaries or namespace_dictionaries.
   // use shared pointers to avoid the question of ownership
@@ -235,6 +236,9 @@ public:
   // This array is required to be value initialized so that the std::vectors are constructed.
   std::array<std::vector<std::shared_ptr<details::feature_dict>>, NUM_NAMESPACES>
       namespace_dictionaries{};  // each namespace has a list of dictionaries attached to it
+  // dictionaries in flat_dictionary form, consulted after namespace_dictionaries
+  std::array<std::vector<std::shared_ptr<const details::flat_dictionary>>, NUM_NAMESPACES>
+      namespace_flat_dictionaries{};
 
   VW::io::logger logger;
   bool quiet;
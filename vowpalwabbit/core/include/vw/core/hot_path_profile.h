@@ -0,0 +1,107 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#  include <intrin.h>
+#  define VW_PROFILE_USE_RDTSC
+#elif defined(__x86_64__) || defined(__i386__)
+#  include <x86intrin.h>
+#  define VW_PROFILE_USE_RDTSC
+#endif
+
+namespace VW
+{
+namespace details
+{
+// Time stamp counter on x86, steady clock nanoseconds elsewhere. Only differences between two reads are meaningful.
+inline uint64_t read_profile_ticks()
+{
+#ifdef VW_PROFILE_USE_RDTSC
+  return __rdtsc();
+#else
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+#endif
+}
+
+inline const char* profile_tick_source()
+{
+#ifdef VW_PROFILE_USE_RDTSC
+  return "rdtsc";
+#else
+  return "steady_clock_ns";
+#endif
+}
+
+// Only one call in PROFILE_SAMPLE_INTERVAL is timed. Reading the clock costs about as much as a gd call on a small
+// example, so timing every call of a deep stack would slow it down by far more than it measures.
+constexpr uint64_t PROFILE_SAMPLE_INTERVAL = 64;
+
+// A counter is only ever updated by one thread. calls is exact, ticks is the time of the timed calls scaled by
+// PROFILE_SAMPLE_INTERVAL, an estimate of the time of all of them.
+class profile_counter
+{
+public:
+  uint64_t calls = 0;
+  uint64_t ticks = 0;
+};
+
+// Counts a call to counter and, for one call in PROFILE_SAMPLE_INTERVAL starting with the first, adds the time between
+// construction and destruction. Does nothing when counter is null, which is the case whenever --profile_hot_path is
+// off.
+class profile_scope
+{
+public:
+  explicit profile_scope(profile_counter* counter)
+      : _counter(counter)
+      , _timed(counter != nullptr && counter->calls % PROFILE_SAMPLE_INTERVAL == 0)
+      , _start(_timed ? read_profile_ticks() : 0)
+  {
+  }
+  ~profile_scope()
+  {
+    if (_counter != nullptr)
+    {
+      _counter->calls++;
+      if (_timed) { _counter->ticks += (read_profile_ticks() - _start) * PROFILE_SAMPLE_INTERVAL; }
+    }
+  }
+  profile_scope(const profile_scope&) = delete;
+  profile_scope& operator=(const profile_scope&) = delete;
+
+private:
+  profile_counter* _counter;
+  bool _timed;
+  uint64_t _start;
+};
+
+// Inclusive time of one learner's learn, predict and multipredict calls. A multipredict call counts once, whatever
+// the number of models it scores.
+class learner_profile
+{
+public:
+  profile_counter learn;
+  profile_counter predict;
+  profile_counter multipredict;
+};
+
+// The stages around the reduction stack. Parsing and setup run on the parser thread, finish_example on the learning
+// thread.
+class hot_path_profile
+{
+public:
+  profile_counter parse;
+  profile_counter setup_example;
+  // Keeps the counters of the two threads off the same cache line.
+  char cache_line_padding[64] = {};
+  profile_counter finish_example;
+};
+}  // namespace details
+}  // namespace VW
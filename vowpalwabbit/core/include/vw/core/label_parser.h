@@ -18,6 +18,8 @@ class label_parser_reuse_mem
 {
 public:
   std::vector<VW::string_view> tokens;
+  // For labels that split the tokens once more, e.g. the action:probability pairs of a ccb outcome.
+  std::vector<VW::string_view> inner_tokens;
 };
 
 class label_parser
@@ -31,6 +31,7 @@
 #include "vw/core/debug_log.h"
 #include "vw/core/example.h"
 #include "vw/core/global_data.h"
+#include "vw/core/hot_path_profile.h"
 #include "vw/core/label_type.h"
 #include "vw/core/memory.h"
 #include "vw/core/metric_sink.h"
@@ -79,6 +80,12 @@ using multi_learner = learner<char, multi_ex>;
 
 void generic_driver(VW::workspace& all);
 void generic_driver(const std::vector<VW::workspace*>& alls);
+// Drive several workspaces from the parser of the first one, each learning on its own thread. The workspaces must
+// agree on the feature hashing and label type of the first one.
+void generic_driver_parallel(const std::vector<VW::workspace*>& alls);
+// Throws unless `all` can train on the examples parsed and set up by `master`, which both multi workspace drivers
+// require. `config` is the position of `all` among the workspaces, for the message.
+void check_multi_config_compatible(const VW::workspace& master, const VW::workspace& all, size_t config);
 void generic_driver_onethread(VW::workspace& all);
 
 namespace details
@@ -189,14 +196,60 @@ inline float noop_sensitivity(void*, base_learner&, example&) { return 0.; }
 inline float noop_sensitivity_base(void*, example&) { return 0.; }
 float recur_sensitivity(void*, base_learner&, example&);
 
-void debug_increment_depth(example& ex);
-void debug_increment_depth(multi_ex& ec_seq);
-void debug_decrement_depth(example& ex);
-void debug_decrement_depth(multi_ex& ec_seq);
-void increment_offset(example& ex, const size_t increment, const size_t i);
-void increment_offset(multi_ex& ec_seq, const size_t increment, const size_t i);
-void decrement_offset(example& ex, const size_t increment, const size_t i);
-void decrement_offset(multi_ex& ec_seq, const size_t increment, const size_t i);
+// These run around every call into every reduction, so they live in the header to be inlined into the dispatch.
+inline void debug_increment_depth(example& ex)
+{
+  if (vw_dbg::TRACK_STACK) { ++ex.debug_current_reduction_depth; }
+}
+inline void debug_increment_depth(multi_ex& ec_seq)
+{
+  if (vw_dbg::TRACK_STACK)
+  {
+    for (auto& ec : ec_seq) { ++ec->debug_current_reduction_depth; }
+  }
+}
+inline void debug_decrement_depth(example& ex)
+{
+  if (vw_dbg::TRACK_STACK) { --ex.debug_current_reduction_depth; }
+}
+inline void debug_decrement_depth(multi_ex& ec_seq)
+{
+  if (vw_dbg::TRACK_STACK)
+  {
+    for (auto& ec : ec_seq) { --ec->debug_current_reduction_depth; }
+  }
+}
+inline void increment_offset(example& ex, const size_t increment, const size_t i)
+{
+  ex.ft_offset += static_cast<uint32_t>(increment * i);
+  debug_increment_depth(ex);
+}
+inline void increment_offset(multi_ex& ec_seq, const size_t increment, const size_t i)
+{
+  for (auto& ec : ec_seq) { ec->ft_offset += static_cast<uint32_t>(increment * i); }
+  debug_increment_depth(ec_seq);
+}
+inline void decrement_offset(example& ex, const size_t increment, const size_t i)
+{
+  assert(ex.ft_offset >= increment * i);
+  ex.ft_offset -= static_cast<uint32_t>(increment * i);
+  debug_decrement_depth(ex);
+}
+inline void decrement_offset(multi_ex& ec_seq, const size_t increment, const size_t i)
+{
+  for (auto ec : ec_seq)
+  {
+    assert(ec->ft_offset >= increment * i);
+    ec->ft_offset -= static_cast<uint32_t>(increment * i);
+  }
+  debug_decrement_depth(ec_seq);
+}
+
+// Multiline learners report their prediction on the first example of the sequence.
+inline polyprediction& first_prediction(example& ex) { return ex.pred; }
+inline polyprediction& first_prediction(multi_ex& ec_seq) { return ec_seq[0]->pred; }
+inline float first_partial_prediction(const example& ex) { return ex.partial_prediction; }
+inline float first_partial_prediction(const multi_ex& ec_seq) { return ec_seq[0]->partial_prediction; }
 
 void learner_build_diagnostic(VW::string_view this_name, VW::string_view base_name, prediction_type_t in_pred_type,
     prediction_type_t base_out_pred_type, label_type_t out_label_type, label_type_t base_in_label_type,
@@ -231,13 +284,14 @@ template <class T, class E>
 class learner
 {
   /// \private
-  void debug_log_message(const example& ec, const std::string& msg)
+  // Takes the message as a literal so that no string is built on every call when debug logging is compiled out.
+  void debug_log_message(const example& ec, const char* msg)
   {
     VW_DBG(ec) << "[" << _name << "." << msg << "]" << std::endl;
   }
 
   // Used as a hook to intercept incorrect calls to the base learner.
-  void debug_log_message(const char& /* ec */, const std::string& msg)
+  void debug_log_message(const char& /* ec */, const char* msg)
   {
     auto message =
         fmt::format("Learner: '{}', function: '{}' was called without first being cast to singleline or multiline.",
@@ -246,7 +300,7 @@ class learner
   }
 
   /// \private
-  void debug_log_message(const multi_ex& ec, const std::string& msg)
+  void debug_log_message(const multi_ex& ec, const char* msg)
   {
     VW_DBG(*ec[0]) << "[" << _name << "." << msg << "]" << std::endl;
   }
@@ -286,7 +340,10 @@ public:
         (!is_multiline() && std::is_same<example, E>::value));  // sanity check under debug compile
     details::increment_offset(ec, increment, i);
     debug_log_message(ec, "learn");
-    _learn_fd.learn_f(_learn_fd.data, *_learn_fd.base, (void*)&ec);
+    {
+      VW::details::profile_scope timer(_profile ? &_profile->learn : nullptr);
+      _learn_fd.learn_f(_learn_fd.data, *_learn_fd.base, (void*)&ec);
+    }
     details::decrement_offset(ec, increment, i);
   }
 
@@ -305,7 +362,10 @@ public:
         (!is_multiline() && std::is_same<example, E>::value));  // sanity check under debug compile
     details::increment_offset(ec, increment, i);
     debug_log_message(ec, "predict");
-    _learn_fd.predict_f(_learn_fd.data, *_learn_fd.base, (void*)&ec);
+    {
+      VW::details::profile_scope timer(_profile ? &_profile->predict : nullptr);
+      _learn_fd.predict_f(_learn_fd.data, *_learn_fd.base, (void*)&ec);
+    }
     details::decrement_offset(ec, increment, i);
   }
 
@@ -314,6 +374,7 @@ public:
   {
     assert((is_multiline() && std::is_same<multi_ex, E>::value) ||
         (!is_multiline() && std::is_same<example, E>::value));  // sanity check under debug compile
+    VW::details::profile_scope timer(_profile ? &_profile->multipredict : nullptr);
     if (_learn_fd.multipredict_f == nullptr)
     {
       details::increment_offset(ec, increment, lo);
@@ -323,10 +384,10 @@ public:
         _learn_fd.predict_f(_learn_fd.data, *_learn_fd.base, (void*)&ec);
         if (finalize_predictions)
         {
-          pred[c] = std::move(ec.pred);  // TODO: this breaks for complex labels because = doesn't do deep copy! (XXX we
-                                         // "fix" this by moving)
+          // TODO: this breaks for complex labels because = doesn't do deep copy! (XXX we "fix" this by moving)
+          pred[c] = std::move(details::first_prediction(ec));
         }
-        else { pred[c].scalar = ec.partial_prediction; }
+        else { pred[c].scalar = details::first_partial_prediction(ec); }
         // pred[c].scalar = finalize_prediction ec.partial_prediction; // TODO: this breaks for complex labels because =
         // doesn't do deep copy! // note works if ec.partial_prediction, but only if finalize_prediction is run????
         details::increment_offset(ec, increment, 1);
@@ -511,6 +572,17 @@ public:
     enabled_reductions.push_back(_name);
   }
 
+  // Start timing learn and predict of this learner and every learner below it. Autorecursive.
+  void enable_profile()
+  {
+    if (!_profile) { _profile = std::make_shared<VW::details::learner_profile>(); }
+    if (_learn_fd.base) { _learn_fd.base->enable_profile(); }
+  }
+
+  // Null unless enable_profile was called.
+  VW_ATTR(nodiscard) const VW::details::learner_profile* get_profile() const { return _profile.get(); }
+  VW_ATTR(nodiscard) VW::details::learner_profile* get_profile() { return _profile.get(); }
+
   base_learner* get_learner_by_name_prefix(const std::string& reduction_name)
   {
     if (_name.find(reduction_name) != std::string::npos) { return (base_learner*)this; }
@@ -649,6 +721,7 @@ private:
   details::add_subtract_with_all_fn _subtract_with_all_fn;
 
   std::shared_ptr<void> _learner_data;
+  std::shared_ptr<VW::details::learner_profile> _profile;
 
   learner() = default;  // Should only be able to construct a learner through make_reduction_learner / make_base_learner
 };
@@ -697,6 +770,28 @@ void multiline_learn_or_predict(multi_learner& base, multi_ex& examples, const u
   else { base.predict(examples, id); }
 }
 
+// Predicts with the `count` consecutive models starting at `lo`, with every example of the sequence at `offset`.
+// pred[i] receives the prediction of model lo + i.
+inline void multiline_multipredict(
+    multi_learner& base, multi_ex& examples, const uint64_t offset, size_t lo, size_t count, polyprediction* pred)
+{
+  std::vector<uint64_t> saved_offsets;
+  saved_offsets.reserve(examples.size());
+  for (auto ec : examples)
+  {
+    saved_offsets.push_back(ec->ft_offset);
+    ec->ft_offset = offset;
+  }
+
+  auto restore_guard = VW::scope_exit(
+      [&saved_offsets, &examples]
+      {
+        for (size_t i = 0; i < examples.size(); i++) { examples[i]->ft_offset = saved_offsets[i]; }
+      });
+
+  base.multipredict(examples, lo, count, pred, true);
+}
+
 VW_WARNING_STATE_PUSH
 VW_WARNING_DISABLE_CAST_FUNC_TYPE
 template <class FluentBuilderT, class DataT, class ExampleT, class BaseLearnerT>
@@ -1089,6 +1184,8 @@ public:
     this->learner_ptr->_add_with_all_fn = nullptr;
     this->learner_ptr->_subtract_fn = nullptr;
     this->learner_ptr->_subtract_with_all_fn = nullptr;
+    // Each learner counts its own calls, reductions added on top of a profiled stack are not profiled.
+    this->learner_ptr->_profile = nullptr;
 
     set_params_per_weight(1);
     this->set_learn_returns_prediction(false);
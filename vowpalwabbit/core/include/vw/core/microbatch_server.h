@@ -0,0 +1,121 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include "vw/core/example.h"
+#include "vw/core/multi_ex.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace VW
+{
+class workspace;
+
+class microbatch_server_options
+{
+public:
+  // Largest number of requests run as one batch.
+  size_t max_batch_size = 32;
+  // How long the oldest queued request may wait for its batch to fill up before the batch is run anyway.
+  std::chrono::microseconds latency_budget{500};
+  // Submitting blocks while this many requests are queued.
+  size_t max_queue_size = 4096;
+};
+
+class microbatch_server_stats
+{
+public:
+  uint64_t requests = 0;
+  uint64_t batches = 0;
+  // Time from submitting a request to its answer, over the most recent requests.
+  std::chrono::nanoseconds p50_latency{0};
+  std::chrono::nanoseconds p99_latency{0};
+  // batch_sizes[n] counts the batches of n requests.
+  std::vector<uint64_t> batch_sizes;
+  // queue_depths[k] counts the batches that were formed with between 2^k and 2^(k+1) - 1 requests queued.
+  std::vector<uint64_t> queue_depths;
+};
+
+/**
+ * \brief Answers prediction and learning requests from many threads with one workspace.
+ *
+ * Requests are queued and picked up by the server's thread in batches: a batch is run as soon as it holds
+ * max_batch_size requests or its oldest request has waited latency_budget. The whole batch is parsed and set up
+ * before the learner runs its examples back to back, then each request is answered through its own future. Requests
+ * are run in the order they were submitted, so learning requests update the model in that order too.
+ *
+ * The workspace must not be used by anyone else while the server is running.
+ */
+class microbatch_server
+{
+public:
+  explicit microbatch_server(VW::workspace& all, microbatch_server_options options = microbatch_server_options());
+  // Answers the requests that are still queued, then stops the server's thread.
+  ~microbatch_server();
+
+  microbatch_server(const microbatch_server&) = delete;
+  microbatch_server& operator=(const microbatch_server&) = delete;
+
+  /**
+   * \brief Queue an example in text format for prediction. Multi-line learners take the lines of one multi-example,
+   * separated by '\n'.
+   * \return The prediction of the request's first example, which is where multi-line learners put theirs too. Read the
+   * member matching the learner's output prediction type. Holds the exception instead if the request failed.
+   */
+  std::future<VW::polyprediction> predict(std::string request);
+  /// \brief Same as predict, but learns from the request's label.
+  std::future<VW::polyprediction> learn(std::string request);
+
+  microbatch_server_stats stats() const;
+
+private:
+  class request
+  {
+  public:
+    std::string text;
+    bool learn = false;
+    std::chrono::steady_clock::time_point submitted;
+    std::promise<VW::polyprediction> answer;
+  };
+
+  std::future<VW::polyprediction> submit(std::string text, bool learn);
+  void run();
+  void run_batch(size_t queue_depth);
+  void parse_request(const request& req, VW::multi_ex& examples);
+  void record_batch(size_t queue_depth);
+  void record_answer(const request& req);
+
+  VW::workspace& _all;
+  microbatch_server_options _options;
+
+  std::mutex _queue_mutex;
+  std::condition_variable _has_requests;
+  std::condition_variable _has_room;
+  std::deque<request> _queue;
+  bool _done = false;
+
+  // Only touched by the server's thread.
+  std::vector<request> _batch;
+  std::vector<VW::multi_ex> _batch_examples;
+
+  mutable std::mutex _stats_mutex;
+  uint64_t _requests = 0;
+  uint64_t _batches = 0;
+  std::vector<uint64_t> _latencies_ns;
+  size_t _next_latency = 0;
+  std::vector<uint64_t> _batch_sizes;
+  std::vector<uint64_t> _queue_depths;
+
+  std::thread _thread;
+};
+}  // namespace VW
@@ -36,6 +36,8 @@ public:
   bool compressed;
   bool chain_hash_json;
   bool flatbuffer = false;
+  bool in_memory_passes = false;
+  bool in_memory_shuffle = false;
 #ifdef VW_BUILD_CSV
   std::unique_ptr<VW::parsers::csv::csv_parser_options> csv_opts;
 #endif
@@ -6,6 +6,7 @@
 
 #include "vw/core/example.h"
 #include "vw/core/global_data.h"
+#include "vw/core/learner.h"
 #include "vw/core/parser.h"
 #include "vw/core/v_array.h"
 #include "vw/io/logger.h"
@@ -16,6 +17,33 @@ namespace VW
 {
 namespace details
 {
+// Fill examples with the next batch of the current pass, either from the input or, with --in_memory_passes, from the
+// examples recorded during the first pass. Returns false at the end of the pass.
+inline bool next_pass_examples(VW::workspace& all, VW::multi_ex& examples)
+{
+  auto* replay = all.example_parser->replay_buffer.get();
+  auto* profile = all.example_parser->profile.get();
+  if (replay != nullptr && replay->replaying())
+  {
+    VW::details::profile_scope timer(profile != nullptr ? &profile->parse : nullptr);
+    return replay->replay_next(all, examples);
+  }
+
+  {
+    VW::details::profile_scope timer(profile != nullptr ? &profile->parse : nullptr);
+    if (all.example_parser->reader(&all, all.example_parser->input, examples) <= 0) { return false; }
+  }
+  {
+    VW::details::profile_scope timer(profile != nullptr ? &profile->setup_example : nullptr);
+    VW::setup_examples(all, examples);
+  }
+  if (replay != nullptr)
+  {
+    replay->record(all.example_parser->lbl_parser, examples, !all.l->is_multiline() || examples.back()->is_newline);
+  }
+  return true;
+}
+
 // DispatchFuncT should be of the form - void(VW::workspace&, const VW::multi_ex&)
 template <typename DispatchFuncT>
 void parse_dispatch(VW::workspace& all, DispatchFuncT& dispatch)
@@ -29,15 +57,24 @@ void parse_dispatch(VW::workspace& all, DispatchFuncT& dispatch)
     {
       examples.push_back(&VW::get_unused_example(&all));  // need at least 1 example
       if (!all.do_reset_source && example_number != all.pass_length && all.max_examples > example_number &&
-          all.example_parser->reader(&all, all.example_parser->input, examples) > 0)
+          next_pass_examples(all, examples))
       {
-        VW::setup_examples(all, examples);
         example_number += examples.size();
         dispatch(all, examples);
       }
       else
       {
-        VW::details::reset_source(all, all.num_bits);
+        // Only daemon mode waits for in-flight examples here, because it has to answer the current client before
+        // accepting the next one. File and cache inputs are rewound in place, and the end_pass example is queued
+        // behind the last example of the pass, so learning never stalls on a pass boundary.
+        auto* replay = all.example_parser->replay_buffer.get();
+        // Once replaying, the input is not read again. Resetting it after the first pass still finalizes a cache
+        // being written.
+        if (replay == nullptr || (!replay->replaying() && all.example_parser->resettable))
+        {
+          VW::details::reset_source(all, all.num_bits);
+        }
+        if (replay != nullptr) { replay->start_pass(); }
         all.do_reset_source = false;
         all.passes_complete++;
 
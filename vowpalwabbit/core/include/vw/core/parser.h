@@ -21,7 +21,9 @@
 #include "vw/common/future_compat.h"
 #include "vw/common/string_view.h"
 #include "vw/core/example.h"
+#include "vw/core/example_replay_buffer.h"
 #include "vw/core/hashstring.h"
+#include "vw/core/hot_path_profile.h"
 #include "vw/core/io_buf.h"
 #include "vw/core/object_pool.h"
 #include "vw/core/queue.h"
@@ -105,6 +107,10 @@ public:
   bool strict_parse;
   std::exception_ptr exc_ptr;
   std::unique_ptr<details::dsjson_metrics> metrics = nullptr;
+  // Set by --in_memory_passes, later passes replay from here instead of the input.
+  std::unique_ptr<details::example_replay_buffer> replay_buffer = nullptr;
+  // Set by --profile_hot_path.
+  std::unique_ptr<details::hot_path_profile> profile = nullptr;
 };
 namespace details
 {
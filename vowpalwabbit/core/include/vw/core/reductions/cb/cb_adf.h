@@ -25,6 +25,7 @@ public:
 
   void learn(VW::LEARNER::multi_learner& base, VW::multi_ex& ec_seq);
   void predict(VW::LEARNER::multi_learner& base, VW::multi_ex& ec_seq);
+  void multipredict(VW::LEARNER::multi_learner& base, VW::multi_ex& ec_seq, size_t count, VW::polyprediction* pred);
   bool update_statistics(const VW::example& ec, const VW::multi_ex& ec_seq, VW::shared_data& sd) const;
 
   cb_adf(VW::cb_type_t cb_type, bool rank_all, float clip_p, bool no_predict, VW::workspace* all)
@@ -50,6 +50,10 @@ void emt_abs(emt_feats&);
 void emt_scale(emt_feats&, float);
 void emt_normalize(emt_feats&);
 emt_feats emt_scale_add(float, const emt_feats&, float, const emt_feats&);
+// Same as above but writes into an existing buffer so hot loops don't allocate.
+void emt_scale_add(float, const emt_feats&, float, const emt_feats&, emt_feats&);
+// Equivalent to emt_norm(emt_scale_add(1, xs, -1, ys)) without materializing the difference.
+float emt_distance(const emt_feats&, const emt_feats&);
 emt_feats emt_router_eigen(std::vector<emt_feats>&, VW::rand_state&);
 
 template <typename RandomIt>
@@ -78,6 +82,12 @@ struct emt_example
   emt_example(VW::workspace&, VW::example*);
 };
 
+// Writes emt_distance(query, memories[i]->full) to distances[i] for every memory of a leaf. The query is scattered
+// once into dense_query, which grows to the largest query index and is left zeroed, so that each memory is scored by a
+// gather over its own features instead of a merge. Results match emt_distance up to float rounding.
+void emt_leaf_distances(const emt_feats& query, const std::vector<std::unique_ptr<emt_example>>& memories,
+    std::vector<float>& dense_query, std::vector<float>& distances);
+
 struct emt_lru
 {
   using K = emt_example*;
@@ -116,6 +126,10 @@ struct emt_tree
   std::unique_ptr<std::vector<std::vector<VW::namespace_index>>> empty_interactions_for_ex;
   std::unique_ptr<std::vector<std::vector<extent_term>>> empty_extent_interactions_for_ex;
 
+  // Buffers reused by emt_leaf_distances when the distance scorer picks from a leaf.
+  std::vector<float> dense_query;
+  std::vector<float> leaf_scores;
+
 #ifdef VW_ENABLE_EMT_DEBUG_TIMER
   int64_t begin = 0;  // for timing performance
 #endif
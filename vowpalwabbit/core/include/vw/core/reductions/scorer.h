@@ -10,5 +10,17 @@ namespace VW
 namespace reductions
 {
 VW::LEARNER::base_learner* scorer_setup(VW::setup_base_i& stack_builder);
-}
+
+namespace details
+{
+class scorer
+{
+public:
+  scorer(VW::workspace* all) : all(all) {}
+  VW::workspace* all;
+  // Set when the base is a plain gd learner and predictions are computed inline instead of calling into it.
+  bool gd_fast_path = false;
+};  // for set_minmax, loss
+}  // namespace details
+}  // namespace reductions
 }  // namespace VW
\ No newline at end of file
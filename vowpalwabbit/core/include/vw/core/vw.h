@@ -131,6 +131,22 @@ std::unique_ptr<VW::workspace> seed_vw_model(VW::workspace& vw_model, const std:
     driver_output_func_t driver_output_func = nullptr, void* driver_output_func_context = nullptr,
     VW::io::logger* custom_logger = nullptr);
 
+/// Creates a lightweight, test only workspace which predicts with the model held
+/// by another workspace, usually one per serving thread. The weights are shared
+/// with \p model and are never allocated or copied for the context. Everything a
+/// prediction writes to (shared_data, the interaction cache, the example pool and
+/// the scratch state of every reduction) is owned by the returned workspace, so
+/// separate contexts can predict concurrently. Nothing may learn on \p model
+/// while contexts created from it are alive, and \p model must outlive them.
+/// Like seed_vw_model, state that reductions keep outside of the weights is not
+/// carried over. Sparse weights are not supported because they insert on read.
+/// @param model Workspace holding the loaded model.
+/// @param extra_args Additional arguments for the context, for example --quiet.
+/// @param custom_logger optional custom logger object to override with
+/// @return std::unique_ptr<VW::workspace> inference context
+std::unique_ptr<VW::workspace> create_inference_context(VW::workspace& model,
+    const std::vector<std::string>& extra_args = {}, VW::io::logger* custom_logger = nullptr);
+
 VW_WARNING_STATE_PUSH
 VW_WARNING_DISABLE_BADLY_FORMED_XML
 /**
@@ -13,24 +13,46 @@ Alekh Agarwal and John Langford, with help Olivier Chapelle.
 #include "vw/core/global_data.h"
 #include "vw/core/vw_allreduce.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <iostream>
 
 static void add_float(float& c1, const float& c2) { c1 += c2; }
 
-void VW::details::accumulate(VW::workspace& all, parameters& weights, size_t offset)
+// Only the weights that were touched are copied out of sparse parameters, so reducing does not allocate every index.
+static void sparse_to_dense(VW::sparse_parameters& weights, float* out, uint64_t length, size_t offset)
 {
-  uint64_t length = UINT64_ONE << all.num_bits;  // This is size of gradient
-  float* local_grad = new float[length];
+  std::fill(out, out + length, 0.f);
+  for (auto it = weights.begin(); it != weights.end(); ++it)
+  {
+    if ((it.index() & (weights.stride() - 1)) == 0) { out[it.index() >> weights.stride_shift()] = (&(*it))[offset]; }
+  }
+}
 
-  if (weights.sparse)
+static void dense_to_sparse(
+    const float* in, VW::sparse_parameters& weights, uint64_t length, size_t offset, float scale)
+{
+  // Existing entries take the reduced value, missing ones are only created when the reduced value is non zero.
+  for (auto it = weights.begin(); it != weights.end(); ++it)
   {
-    for (uint64_t i = 0; i < length; i++)
+    if ((it.index() & (weights.stride() - 1)) == 0)
     {
-      local_grad[i] = (&(weights.sparse_weights[i << weights.sparse_weights.stride_shift()]))[offset];
+      (&(*it))[offset] = in[it.index() >> weights.stride_shift()] / scale;
     }
   }
+  for (uint64_t i = 0; i < length; i++)
+  {
+    if (in[i] != 0.f) { (&(weights[i << weights.stride_shift()]))[offset] = in[i] / scale; }
+  }
+}
+
+void VW::details::accumulate(VW::workspace& all, parameters& weights, size_t offset)
+{
+  uint64_t length = UINT64_ONE << all.num_bits;  // This is size of gradient
+  float* local_grad = new float[length];
+
+  if (weights.sparse) { sparse_to_dense(weights.sparse_weights, local_grad, length, offset); }
   else
   {
     for (uint64_t i = 0; i < length; i++)
@@ -41,13 +63,7 @@ void VW::details::accumulate(VW::workspace& all, parameters& weights, size_t off
 
   VW::details::all_reduce<float, add_float>(all, local_grad, length);  // TODO: modify to not use first()
 
-  if (weights.sparse)
-  {
-    for (uint64_t i = 0; i < length; i++)
-    {
-      (&(weights.sparse_weights[i << weights.sparse_weights.stride_shift()]))[offset] = local_grad[i];
-    }
-  }
+  if (weights.sparse) { dense_to_sparse(local_grad, weights.sparse_weights, length, offset, 1.f); }
   else
   {
     for (uint64_t i = 0; i < length; i++)
@@ -72,13 +88,7 @@ void VW::details::accumulate_avg(VW::workspace& all, parameters& weights, size_t
   float numnodes = static_cast<float>(all.all_reduce->total);
   float* local_grad = new float[length];
 
-  if (weights.sparse)
-  {
-    for (uint64_t i = 0; i < length; i++)
-    {
-      local_grad[i] = (&(weights.sparse_weights[i << weights.sparse_weights.stride_shift()]))[offset];
-    }
-  }
+  if (weights.sparse) { sparse_to_dense(weights.sparse_weights, local_grad, length, offset); }
   else
   {
     for (uint64_t i = 0; i < length; i++)
@@ -89,13 +99,7 @@ void VW::details::accumulate_avg(VW::workspace& all, parameters& weights, size_t
 
   VW::details::all_reduce<float, add_float>(all, local_grad, length);  // TODO: modify to not use first()
 
-  if (weights.sparse)
-  {
-    for (uint64_t i = 0; i < length; i++)
-    {
-      (&(weights.sparse_weights[i << weights.sparse_weights.stride_shift()]))[offset] = local_grad[i] / numnodes;
-    }
-  }
+  if (weights.sparse) { dense_to_sparse(local_grad, weights.sparse_weights, length, offset, numnodes); }
   else
   {
     for (uint64_t i = 0; i < length; i++)
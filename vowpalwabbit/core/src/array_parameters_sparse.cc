@@ -7,63 +7,120 @@
 #include "vw/common/vw_exception.h"
 #include "vw/core/memory.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdlib>
 #include <functional>
-#include <unordered_map>
+#include <vector>
+
+namespace
+{
+constexpr size_t INITIAL_TABLE_SIZE = 1024;
+// Number of weights allocated at once for stride blocks.
+constexpr size_t SLAB_SIZE = 1 << 14;
+
+// Feature indices are hashes already but the low bits are often the stride or offset, mix them before masking.
+inline uint64_t slot_hash(uint64_t index)
+{
+  index ^= index >> 33;
+  index *= 0xff51afd7ed558ccdULL;
+  index ^= index >> 33;
+  return index;
+}
+}  // namespace
+
+VW::weight* VW::sparse_parameters::allocate_block() const
+{
+  const size_t block_size = stride();
+  if (_slabs.empty() || _slab_remaining < block_size)
+  {
+    const size_t slab_size = std::max(SLAB_SIZE, block_size);
+    _slabs.push_back(VW::details::calloc_mergable_or_throw<VW::weight>(slab_size));
+    _slab_next = _slabs.back();
+    _slab_remaining = slab_size;
+  }
+  VW::weight* block = _slab_next;
+  _slab_next += block_size;
+  _slab_remaining -= block_size;
+  return block;
+}
+
+void VW::sparse_parameters::grow() const
+{
+  std::vector<details::sparse_slot> old_slots(_slots.empty() ? INITIAL_TABLE_SIZE : _slots.size() * 2);
+  old_slots.swap(_slots);
+
+  const size_t table_mask = _slots.size() - 1;
+  for (const auto& slot : old_slots)
+  {
+    if (slot.block == nullptr) { continue; }
+    size_t pos = slot_hash(slot.index) & table_mask;
+    while (_slots[pos].block != nullptr) { pos = (pos + 1) & table_mask; }
+    _slots[pos] = slot;
+  }
+}
 
 VW::weight* VW::sparse_parameters::get_or_default_and_get(size_t i) const
 {
   uint64_t index = i & _weight_mask;
-  auto iter = _map.find(index);
-  if (iter == _map.end())
+  // keep the load factor under 3/4
+  if ((_size + 1) * 4 > _slots.size() * 3) { grow(); }
+
+  const size_t table_mask = _slots.size() - 1;
+  size_t pos = slot_hash(index) & table_mask;
+  while (_slots[pos].block != nullptr)
   {
-    _map.insert(std::make_pair(index, VW::details::calloc_mergable_or_throw<VW::weight>(stride())));
-    iter = _map.find(index);
-    if (_default_func != nullptr) { _default_func(iter->second, index); }
+    if (_slots[pos].index == index) { return _slots[pos].block; }
+    pos = (pos + 1) & table_mask;
   }
-  return iter->second;
+
+  auto& slot = _slots[pos];
+  slot.index = index;
+  slot.block = allocate_block();
+  _size++;
+  if (_default_func != nullptr) { _default_func(slot.block, index); }
+  return slot.block;
 }
 
 VW::sparse_parameters::sparse_parameters(size_t length, uint32_t stride_shift)
-    : _weight_mask((length << stride_shift) - 1)
+    : _size(0)
+    , _slab_next(nullptr)
+    , _slab_remaining(0)
+    , _weight_mask((length << stride_shift) - 1)
     , _stride_shift(stride_shift)
     , _seeded(false)
-    , _delete(false)
     , _default_func(nullptr)
 {
 }
 
 VW::sparse_parameters::sparse_parameters()
-    : _weight_mask(0), _stride_shift(0), _seeded(false), _delete(false), _default_func(nullptr)
+    : _size(0)
+    , _slab_next(nullptr)
+    , _slab_remaining(0)
+    , _weight_mask(0)
+    , _stride_shift(0)
+    , _seeded(false)
+    , _default_func(nullptr)
 {
 }
 
-VW::sparse_parameters::~sparse_parameters()
+VW::sparse_parameters::~sparse_parameters() { free_slabs(); }
+
+void VW::sparse_parameters::free_slabs()
 {
-  if (!_delete && !_seeded)  // don't free weight vector if it is shared with another instance
-  {
-    for (auto& iter : _map)
-    {
-      auto* weight_ptr = iter.second;
-      free(weight_ptr);
-    }
-    _map.clear();
-    _delete = true;
-  }
+  // A shallow copy only owns the blocks it allocated itself, the ones it shares stay with the source.
+  for (auto* slab : _slabs) { free(slab); }
+  _slabs.clear();
+  _slab_next = nullptr;
+  _slab_remaining = 0;
 }
 
 void VW::sparse_parameters::shallow_copy(const sparse_parameters& input)
 {
   // TODO: this is level-1 copy (VW::weight* are stilled shared)
-  if (!_seeded)
-  {
-    for (auto& iter : _map)
-    {
-      auto* weight_ptr = iter.second;
-      free(weight_ptr);
-    }
-  }
-  _map = input._map;
+  free_slabs();
+  _slots = input._slots;
+  _size = input._size;
   _weight_mask = input._weight_mask;
   _stride_shift = input._stride_shift;
   _seeded = true;
@@ -71,7 +128,10 @@ void VW::sparse_parameters::shallow_copy(const sparse_parameters& input)
 
 void VW::sparse_parameters::set_zero(size_t offset)
 {
-  for (auto& iter : _map) { (&(*(iter.second)))[offset] = 0; }
+  for (auto& slot : _slots)
+  {
+    if (slot.block != nullptr) { slot.block[offset] = 0; }
+  }
 }
 #ifndef _WIN32
 void VW::sparse_parameters::share(size_t /* length */) { THROW_OR_RETURN("Operation not supported on Windows"); }
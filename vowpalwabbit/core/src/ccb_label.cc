@@ -58,14 +58,13 @@ VW::action_score convert_to_score(
 }
 
 //<action>:<cost>:<probability>,<action>:<probability>,<action>:<probability>,…
-VW::ccb_outcome* parse_outcome(VW::string_view outcome, VW::io::logger& logger)
+void parse_outcome(VW::ccb_outcome& ccb_outcome, VW::string_view outcome, VW::label_parser_reuse_mem& reuse_mem,
+    VW::io::logger& logger)
 {
-  auto& ccb_outcome = *(new VW::ccb_outcome());
-
-  std::vector<VW::string_view> split_commas;
+  auto& split_commas = reuse_mem.tokens;
   VW::tokenize(',', outcome, split_commas);
 
-  std::vector<VW::string_view> split_colons;
+  auto& split_colons = reuse_mem.inner_tokens;
   VW::tokenize(':', split_commas[0], split_colons);
 
   if (split_colons.size() != 3) THROW("Malformed ccb label");
@@ -83,8 +82,6 @@ VW::ccb_outcome* parse_outcome(VW::string_view outcome, VW::io::logger& logger)
     if (split_colons.size() != 2) THROW("Must be action probability pairs");
     ccb_outcome.probabilities.push_back(convert_to_score(split_colons[0], split_colons[1], logger));
   }
-
-  return &ccb_outcome;
 }
 
 void parse_explicit_inclusions(
@@ -153,7 +150,7 @@ void parse_ccb_label(ccb_label& ld, VW::label_parser_reuse_mem& reuse_mem, const
       {
         if (ld.outcome != nullptr) { THROW("There may be only 1 outcome associated with a slot.") }
 
-        ld.outcome = parse_outcome(words[i], logger);
+        parse_outcome(ld.emplace_outcome(), words[i], reuse_mem, logger);
       }
       else
       {
@@ -200,16 +197,11 @@ size_t read_model_field(io_buf& io, VW::ccb_label& ccb)
 {
   size_t bytes = 0;
   // Since read_cached_features doesn't default the label we must do it here.
-  if (ccb.outcome != nullptr) { ccb.outcome->probabilities.clear(); }
-  ccb.explicit_included_actions.clear();
+  ccb.reset_to_default();
   bytes += read_model_field(io, ccb.type);
   bool outcome_is_present;
   bytes += read_model_field(io, outcome_is_present);
-  if (outcome_is_present)
-  {
-    ccb.outcome = new VW::ccb_outcome();
-    bytes += read_model_field(io, *ccb.outcome);
-  }
+  if (outcome_is_present) { bytes += read_model_field(io, ccb.emplace_outcome()); }
   bytes += read_model_field(io, ccb.explicit_included_actions);
   bytes += read_model_field(io, ccb.weight);
   return bytes;
@@ -230,41 +222,47 @@ bool ccb_label::is_test_label() const { return outcome == nullptr; }
 bool ccb_label::is_labeled() const { return !is_test_label(); }
 void ccb_label::reset_to_default()
 {
-  // This is tested against nullptr, so unfortunately as things are this must be deleted when not used.
+  // This is tested against nullptr, so the outcome is detached and kept for the next emplace_outcome.
   if (outcome != nullptr)
   {
-    delete outcome;
+    if (_released_outcome == nullptr) { _released_outcome = outcome; }
+    else { delete outcome; }
     outcome = nullptr;
   }
 
-  explicit_included_actions.clear();
+  explicit_included_actions.clear_noshrink();
   type = ccb_example_type::UNSET;
   weight = 1.0;
 }
-ccb_label::~ccb_label()
+ccb_outcome& ccb_label::emplace_outcome()
 {
-  if (outcome != nullptr)
+  if (outcome == nullptr)
   {
-    delete outcome;
-    outcome = nullptr;
+    std::swap(outcome, _released_outcome);
+    if (outcome == nullptr) { outcome = new ccb_outcome(); }
   }
+  outcome->cost = 0.f;
+  outcome->probabilities.clear_noshrink();
+  return *outcome;
+}
+ccb_label::~ccb_label()
+{
+  delete outcome;
+  outcome = nullptr;
+  delete _released_outcome;
+  _released_outcome = nullptr;
 }
 ccb_label& ccb_label::operator=(const ccb_label& other)
 {
   if (this == &other) { return *this; }
 
-  if (outcome != nullptr)
-  {
-    delete outcome;
-    outcome = nullptr;
-  }
-
   type = other.type;
-  outcome = nullptr;
-  if (other.outcome != nullptr)
+  if (other.outcome != nullptr) { emplace_outcome() = *other.outcome; }
+  else if (outcome != nullptr)
   {
-    outcome = new ccb_outcome();
-    *outcome = *other.outcome;
+    delete _released_outcome;
+    _released_outcome = outcome;
+    outcome = nullptr;
   }
   explicit_included_actions = other.explicit_included_actions;
   weight = other.weight;
@@ -288,6 +286,7 @@ ccb_label& ccb_label::operator=(ccb_label&& other) noexcept
   std::swap(outcome, other.outcome);
   std::swap(explicit_included_actions, other.explicit_included_actions);
   std::swap(weight, other.weight);
+  std::swap(_released_outcome, other._released_outcome);
   return *this;
 }
 ccb_label::ccb_label(ccb_label&& other) noexcept
@@ -300,5 +299,6 @@ ccb_label::ccb_label(ccb_label&& other) noexcept
   std::swap(outcome, other.outcome);
   std::swap(explicit_included_actions, other.explicit_included_actions);
   std::swap(weight, other.weight);
+  std::swap(_released_outcome, other._released_outcome);
 }
 }  // namespace VW
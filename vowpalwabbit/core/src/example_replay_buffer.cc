@@ -0,0 +1,145 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/example_replay_buffer.h"
+
+#include "vw/common/vw_exception.h"
+#include "vw/core/global_data.h"
+#include "vw/core/label_parser.h"
+#include "vw/core/parser.h"
+#include "vw/core/reductions/conditional_contextual_bandit.h"
+#include "vw/core/vw.h"
+#include "vw/io/io_adapter.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <numeric>
+
+VW::details::example_replay_buffer::example_replay_buffer(bool shuffle, uint64_t seed)
+    : _labels(std::make_shared<std::vector<char>>()), _shuffle(shuffle), _random_state(seed)
+{
+  _label_writer.add_file(VW::io::create_vector_writer(_labels));
+}
+
+void VW::details::example_replay_buffer::record(
+    VW::label_parser& lbl_parser, const VW::multi_ex& examples, bool ends_record)
+{
+  if (!_record_open) { _record_starts.push_back(_examples.size()); }
+
+  for (const auto* ec : examples)
+  {
+    for (const auto ns : ec->indices)
+    {
+      const auto& fs = ec->feature_space[ns];
+      _values.insert(_values.end(), fs.values.begin(), fs.values.end());
+      _indices.insert(_indices.end(), fs.indices.begin(), fs.indices.end());
+      _space_names.insert(_space_names.end(), fs.space_names.begin(), fs.space_names.end());
+      _extents.insert(_extents.end(), fs.namespace_extents.begin(), fs.namespace_extents.end());
+      _namespaces.push_back({ns, fs.sum_feat_sq, _values.size(), _space_names.size(), _extents.size()});
+    }
+
+    lbl_parser.cache_label(ec->l, ec->ex_reduction_features, _label_writer, "_label", false);
+    _label_writer.flush();
+    _tags.insert(_tags.end(), ec->tag.begin(), ec->tag.end());
+
+    _examples.push_back({_labels->size(), _tags.size(), _namespaces.size(), ec->num_features, ec->weight,
+        ec->test_only, ec->is_newline, ec->sorted});
+  }
+
+  _record_open = !ends_record;
+}
+
+void VW::details::example_replay_buffer::start_pass()
+{
+  if (!_replaying && !_labels->empty())
+  {
+    // The reader owns its buffer and frees it with std::free.
+    auto* bytes = static_cast<char*>(std::malloc(_labels->size()));
+    if (bytes == nullptr) { THROW("Out of memory while storing the examples of --in_memory_passes"); }
+    std::memcpy(bytes, _labels->data(), _labels->size());
+    _label_reader.replace_buffer(bytes, _labels->size());
+    std::vector<char>().swap(*_labels);
+  }
+
+  _replaying = true;
+  _record_open = false;
+  _next_record = 0;
+
+  _order.resize(_record_starts.size());
+  std::iota(_order.begin(), _order.end(), 0);
+  if (!_shuffle) { return; }
+
+  for (size_t i = _order.size(); i > 1; --i)
+  {
+    auto j = static_cast<size_t>(_random_state.get_and_update_random() * i);
+    if (j >= i) { j = i - 1; }
+    std::swap(_order[i - 1], _order[j]);
+  }
+}
+
+bool VW::details::example_replay_buffer::replay_next(VW::workspace& all, VW::multi_ex& examples)
+{
+  if (_next_record >= _order.size()) { return false; }
+
+  const size_t record = _order[_next_record++];
+  const size_t begin = _record_starts[record];
+  const size_t end = record + 1 < _record_starts.size() ? _record_starts[record + 1] : _examples.size();
+
+  auto& p = *all.example_parser;
+  for (size_t i = begin; i < end; ++i)
+  {
+    if (i != begin) { examples.push_back(&VW::get_unused_example(&all)); }
+    const auto& stored = _examples[i];
+    const auto* previous = i == 0 ? nullptr : &_examples[i - 1];
+    auto& ec = *examples.back();
+
+    const size_t namespace_begin = previous == nullptr ? 0 : previous->namespaces_end;
+    for (size_t n = namespace_begin; n < stored.namespaces_end; ++n)
+    {
+      const auto& ns = _namespaces[n];
+      const auto* previous_ns = n == 0 ? nullptr : &_namespaces[n - 1];
+      const size_t features_begin = previous_ns == nullptr ? 0 : previous_ns->features_end;
+      const size_t space_names_begin = previous_ns == nullptr ? 0 : previous_ns->space_names_end;
+      const size_t extents_begin = previous_ns == nullptr ? 0 : previous_ns->extents_end;
+
+      auto& fs = ec.feature_space[ns.index];
+      fs.values.insert(fs.values.end(), _values.data() + features_begin, _values.data() + ns.features_end);
+      fs.indices.insert(fs.indices.end(), _indices.data() + features_begin, _indices.data() + ns.features_end);
+      fs.space_names.assign(_space_names.begin() + space_names_begin, _space_names.begin() + ns.space_names_end);
+      fs.namespace_extents.assign(_extents.begin() + extents_begin, _extents.begin() + ns.extents_end);
+      fs.sum_feat_sq = ns.sum_feat_sq;
+      ec.indices.push_back(ns.index);
+    }
+
+    p.lbl_parser.default_label(ec.l);
+    _label_reader.set(_label_reader.buffer_start() + (previous == nullptr ? 0 : previous->label_end));
+    p.lbl_parser.read_cached_label(ec.l, ec.ex_reduction_features, _label_reader);
+
+    const size_t tag_begin = previous == nullptr ? 0 : previous->tag_end;
+    ec.tag.insert(ec.tag.end(), _tags.data() + tag_begin, _tags.data() + stored.tag_end);
+    ec.weight = stored.weight;
+    ec.test_only = stored.test_only;
+    ec.is_newline = stored.is_newline;
+    ec.sorted = stored.sorted;
+    ec.num_features = stored.num_features;
+
+    // The per-pass part of setup_example, the features are already in their final form.
+    ec.partial_prediction = 0.f;
+    ec.loss = 0.f;
+    ec.debug_current_reduction_depth = 0;
+    ec.reset_total_sum_feat_sq();
+    ec._use_permutations = all.permutations;
+    ec.interactions = &all.interactions;
+    ec.extent_interactions = &all.extent_interactions;
+
+    p.num_setup_examples++;
+    if (!p.emptylines_separate_examples ||
+        (VW::example_is_newline(ec) &&
+            (p.lbl_parser.label_type != VW::label_type_t::CCB || VW::reductions::ccb::ec_is_example_unset(ec))))
+    {
+      p.in_pass_counter++;
+    }
+  }
+  return true;
+}
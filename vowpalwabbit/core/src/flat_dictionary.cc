@@ -0,0 +1,327 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/flat_dictionary.h"
+
+#include "vw/common/hash.h"
+#include "vw/common/vw_exception.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+#ifndef _WIN32
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+namespace
+{
+constexpr char FLAT_DICTIONARY_MAGIC[8] = {'V', 'W', 'F', 'D', 'I', 'C', 'T', '1'};
+constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+constexpr uint32_t BUCKET_SEED = 0x9e3779b9;
+constexpr uint32_t MAX_DISPLACEMENT = 1 << 24;
+
+class flat_dictionary_header
+{
+public:
+  char magic[8];
+  uint32_t byte_order;
+  uint32_t hash_seed;
+  uint64_t num_entries;
+  uint64_t num_buckets;
+  uint64_t table_size;
+  uint64_t num_features;
+  uint64_t key_bytes;
+  uint64_t reserved;
+};
+static_assert(sizeof(flat_dictionary_header) == 64, "flat dictionary header layout changed");
+
+// An empty slot has feature_count == 0, dictionaries never store words without features.
+class flat_dictionary_slot
+{
+public:
+  uint64_t key_offset;
+  uint64_t feature_offset;
+  uint32_t key_length;
+  uint32_t feature_count;
+  float sum_feat_sq;
+  uint32_t unused;
+};
+static_assert(sizeof(flat_dictionary_slot) == 32, "flat dictionary slot layout changed");
+
+constexpr uint64_t align8(uint64_t n) { return (n + 7) & ~static_cast<uint64_t>(7); }
+
+// Offsets of each section, all 8 byte aligned.
+class flat_dictionary_layout
+{
+public:
+  explicit flat_dictionary_layout(const flat_dictionary_header& h)
+  {
+    displacements = sizeof(flat_dictionary_header);
+    slots = displacements + align8(h.num_buckets * sizeof(uint32_t));
+    indices = slots + h.table_size * sizeof(flat_dictionary_slot);
+    values = indices + h.num_features * sizeof(VW::feature_index);
+    keys = values + align8(h.num_features * sizeof(VW::feature_value));
+    total = keys + h.key_bytes;
+  }
+  uint64_t displacements;
+  uint64_t slots;
+  uint64_t indices;
+  uint64_t values;
+  uint64_t keys;
+  uint64_t total;
+};
+
+uint64_t bucket_of(VW::string_view word, uint64_t num_buckets)
+{
+  return VW::uniform_hash(word.data(), word.size(), BUCKET_SEED) % num_buckets;
+}
+
+uint64_t slot_of(VW::string_view word, uint32_t displacement, uint64_t table_size)
+{
+  return VW::uniform_hash(word.data(), word.size(), displacement) % table_size;
+}
+
+const flat_dictionary_header& header_of(const char* data)
+{
+  return *reinterpret_cast<const flat_dictionary_header*>(data);
+}
+
+// find trusts the slots, so a corrupt file must not let any of them point outside of the key and feature sections.
+// The displacements need no check, slot_of reduces them modulo the table size.
+bool has_valid_slots(const char* data, const flat_dictionary_header& h)
+{
+  const flat_dictionary_layout layout(h);
+  const auto* slots = reinterpret_cast<const flat_dictionary_slot*>(data + layout.slots);
+  for (uint64_t i = 0; i < h.table_size; ++i)
+  {
+    const auto& slot = slots[i];
+    if (slot.feature_count == 0) { continue; }
+    if (slot.key_offset > h.key_bytes || slot.key_length > h.key_bytes - slot.key_offset) { return false; }
+    if (slot.feature_offset > h.num_features || slot.feature_count > h.num_features - slot.feature_offset)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::mutex& loaded_dictionaries_lock()
+{
+  static std::mutex lock;
+  return lock;
+}
+
+std::unordered_map<std::string, std::weak_ptr<const VW::details::flat_dictionary>>& loaded_dictionaries()
+{
+  static std::unordered_map<std::string, std::weak_ptr<const VW::details::flat_dictionary>> dictionaries;
+  return dictionaries;
+}
+}  // namespace
+
+VW::details::flat_dictionary::~flat_dictionary()
+{
+#ifndef _WIN32
+  if (_mapped) { munmap(const_cast<char*>(_data), _length); }
+#endif
+}
+
+bool VW::details::flat_dictionary::is_flat_dictionary_file(const std::string& file_name)
+{
+  std::ifstream file(file_name, std::ios::binary);
+  char magic[sizeof(FLAT_DICTIONARY_MAGIC)];
+  if (!file.read(magic, sizeof(magic))) { return false; }
+  return std::memcmp(magic, FLAT_DICTIONARY_MAGIC, sizeof(magic)) == 0;
+}
+
+std::shared_ptr<const VW::details::flat_dictionary> VW::details::flat_dictionary::load(const std::string& file_name)
+{
+  std::lock_guard<std::mutex> lock(loaded_dictionaries_lock());
+  auto& cache = loaded_dictionaries();
+  auto cached = cache.find(file_name);
+  if (cached != cache.end())
+  {
+    if (auto dict = cached->second.lock()) { return dict; }
+  }
+
+  std::shared_ptr<flat_dictionary> dict(new flat_dictionary());
+#ifndef _WIN32
+  int fd = open(file_name.c_str(), O_RDONLY);
+  if (fd < 0) { THROW("error: cannot open flat dictionary '" << file_name << "'") }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(flat_dictionary_header)))
+  {
+    close(fd);
+    THROW("error: flat dictionary '" << file_name << "' is truncated")
+  }
+  dict->_length = static_cast<size_t>(st.st_size);
+  void* mapped = mmap(nullptr, dict->_length, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (mapped == MAP_FAILED) { THROW("error: cannot map flat dictionary '" << file_name << "'") }
+  dict->_data = static_cast<const char*>(mapped);
+  dict->_mapped = true;
+#else
+  std::ifstream file(file_name, std::ios::binary | std::ios::ate);
+  if (!file) { THROW("error: cannot open flat dictionary '" << file_name << "'") }
+  dict->_length = static_cast<size_t>(file.tellg());
+  if (dict->_length < sizeof(flat_dictionary_header))
+  {
+    THROW("error: flat dictionary '" << file_name << "' is truncated")
+  }
+  dict->_owned.reset(new char[dict->_length]);
+  file.seekg(0);
+  file.read(dict->_owned.get(), dict->_length);
+  dict->_data = dict->_owned.get();
+#endif
+
+  const auto& h = header_of(dict->_data);
+  if (std::memcmp(h.magic, FLAT_DICTIONARY_MAGIC, sizeof(FLAT_DICTIONARY_MAGIC)) != 0)
+  {
+    THROW("error: '" << file_name << "' is not a flat dictionary")
+  }
+  if (h.byte_order != BYTE_ORDER_MARK)
+  {
+    THROW("error: flat dictionary '" << file_name << "' was written on a machine with a different byte order")
+  }
+  // Each count is bounded by the file length first, so that computing the layout cannot overflow.
+  const auto length = static_cast<uint64_t>(dict->_length);
+  if (h.num_buckets == 0 || h.table_size == 0 || h.num_buckets > length || h.table_size > length ||
+      h.num_features > length || h.key_bytes > length || flat_dictionary_layout(h).total > length)
+  {
+    THROW("error: flat dictionary '" << file_name << "' is truncated")
+  }
+  if (!has_valid_slots(dict->_data, h)) { THROW("error: flat dictionary '" << file_name << "' is corrupt") }
+
+  cache[file_name] = dict;
+  return dict;
+}
+
+void VW::details::flat_dictionary::save(const feature_dict& dict, uint32_t hash_seed, const std::string& file_name)
+{
+  std::vector<std::pair<VW::string_view, const VW::features*>> entries;
+  entries.reserve(dict.size());
+  for (const auto& kv : dict)
+  {
+    if (!kv.second->empty()) { entries.emplace_back(kv.first, kv.second.get()); }
+  }
+
+  flat_dictionary_header h;
+  std::memcpy(h.magic, FLAT_DICTIONARY_MAGIC, sizeof(FLAT_DICTIONARY_MAGIC));
+  h.byte_order = BYTE_ORDER_MARK;
+  h.hash_seed = hash_seed;
+  h.num_entries = entries.size();
+  h.num_buckets = entries.size() / 4 + 1;
+  h.table_size = entries.size() + entries.size() / 4 + 1;
+  h.num_features = 0;
+  h.key_bytes = 0;
+  h.reserved = 0;
+
+  // Hash and displace: place the largest buckets first, trying displacements until every word of a bucket lands on
+  // a free slot.
+  std::vector<std::vector<size_t>> buckets(h.num_buckets);
+  for (size_t i = 0; i < entries.size(); ++i) { buckets[bucket_of(entries[i].first, h.num_buckets)].push_back(i); }
+  std::vector<size_t> bucket_order(h.num_buckets);
+  for (size_t b = 0; b < bucket_order.size(); ++b) { bucket_order[b] = b; }
+  std::stable_sort(bucket_order.begin(), bucket_order.end(),
+      [&](size_t lhs, size_t rhs) { return buckets[lhs].size() > buckets[rhs].size(); });
+
+  std::vector<uint32_t> displacements(h.num_buckets, 0);
+  std::vector<int64_t> slot_entry(h.table_size, -1);
+  std::vector<uint64_t> candidate_slots;
+  for (const auto b : bucket_order)
+  {
+    const auto& bucket = buckets[b];
+    if (bucket.empty()) { break; }
+    uint32_t d = 0;
+    for (; d < MAX_DISPLACEMENT; ++d)
+    {
+      candidate_slots.clear();
+      bool placed = true;
+      for (const auto i : bucket)
+      {
+        const auto slot = slot_of(entries[i].first, d, h.table_size);
+        if (slot_entry[slot] != -1 ||
+            std::find(candidate_slots.begin(), candidate_slots.end(), slot) != candidate_slots.end())
+        {
+          placed = false;
+          break;
+        }
+        candidate_slots.push_back(slot);
+      }
+      if (placed) { break; }
+    }
+    if (d == MAX_DISPLACEMENT) { THROW("error: cannot build a perfect hash for dictionary '" << file_name << "'") }
+    displacements[b] = d;
+    for (size_t k = 0; k < bucket.size(); ++k) { slot_entry[candidate_slots[k]] = static_cast<int64_t>(bucket[k]); }
+  }
+
+  std::vector<flat_dictionary_slot> slots(h.table_size);
+  std::vector<VW::feature_index> indices;
+  std::vector<VW::feature_value> values;
+  std::string keys;
+  for (size_t s = 0; s < slots.size(); ++s)
+  {
+    if (slot_entry[s] == -1) { continue; }
+    auto& slot = slots[s];
+    const auto& entry = entries[static_cast<size_t>(slot_entry[s])];
+    slot.key_offset = keys.size();
+    slot.key_length = static_cast<uint32_t>(entry.first.size());
+    slot.feature_offset = indices.size();
+    slot.feature_count = static_cast<uint32_t>(entry.second->size());
+    slot.sum_feat_sq = entry.second->sum_feat_sq;
+    keys.append(entry.first.data(), entry.first.size());
+    indices.insert(indices.end(), entry.second->indices.begin(), entry.second->indices.end());
+    values.insert(values.end(), entry.second->values.begin(), entry.second->values.end());
+  }
+  h.num_features = indices.size();
+  h.key_bytes = keys.size();
+
+  const flat_dictionary_layout layout(h);
+  std::ofstream out(file_name, std::ios::binary | std::ios::trunc);
+  if (!out) { THROW("error: cannot write flat dictionary '" << file_name << "'") }
+  const char padding[8] = {0};
+  const auto write_section = [&](const void* data, uint64_t bytes, uint64_t end_offset)
+  {
+    out.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+    const auto written = static_cast<uint64_t>(out.tellp());
+    if (end_offset > written) { out.write(padding, static_cast<std::streamsize>(end_offset - written)); }
+  };
+  write_section(&h, sizeof(h), layout.displacements);
+  write_section(displacements.data(), displacements.size() * sizeof(uint32_t), layout.slots);
+  write_section(slots.data(), slots.size() * sizeof(flat_dictionary_slot), layout.indices);
+  write_section(indices.data(), indices.size() * sizeof(VW::feature_index), layout.values);
+  write_section(values.data(), values.size() * sizeof(VW::feature_value), layout.keys);
+  write_section(keys.data(), keys.size(), layout.total);
+  if (!out) { THROW("error: failed writing flat dictionary '" << file_name << "'") }
+}
+
+bool VW::details::flat_dictionary::find(VW::string_view word, flat_dictionary_entry& entry) const
+{
+  const auto& h = header_of(_data);
+  const flat_dictionary_layout layout(h);
+  const auto* displacements = reinterpret_cast<const uint32_t*>(_data + layout.displacements);
+  const auto* slots = reinterpret_cast<const flat_dictionary_slot*>(_data + layout.slots);
+
+  const auto& slot = slots[slot_of(word, displacements[bucket_of(word, h.num_buckets)], h.table_size)];
+  if (slot.feature_count == 0 || slot.key_length != word.size() ||
+      std::memcmp(_data + layout.keys + slot.key_offset, word.data(), word.size()) != 0)
+  {
+    return false;
+  }
+
+  entry.indices = reinterpret_cast<const VW::feature_index*>(_data + layout.indices) + slot.feature_offset;
+  entry.values = reinterpret_cast<const VW::feature_value*>(_data + layout.values) + slot.feature_offset;
+  entry.size = slot.feature_count;
+  entry.sum_feat_sq = slot.sum_feat_sq;
+  return true;
+}
+
+size_t VW::details::flat_dictionary::size() const { return static_cast<size_t>(header_of(_data).num_entries); }
+
+uint32_t VW::details::flat_dictionary::hash_seed() const { return header_of(_data).hash_seed; }
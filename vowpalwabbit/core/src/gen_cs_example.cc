@@ -182,3 +182,15 @@ void VW::details::cs_prep_labels(VW::multi_ex& examples, std::vector<VW::cb_labe
     ec->ft_offset = offset;
   }
 }
+
+void VW::details::cs_restore_labels(VW::multi_ex& examples, std::vector<VW::cb_label>& cb_labels,
+    std::vector<VW::cs_label>& prepped_cs_labels, uint64_t saved_offset)
+{
+  for (size_t i = 0; i < examples.size(); ++i)
+  {
+    prepped_cs_labels[i] = std::move(examples[i]->l.cs);
+    examples[i]->l.cs.costs.clear();
+    examples[i]->l.cb = std::move(cb_labels[i]);
+    examples[i]->ft_offset = saved_offset;
+  }
+}
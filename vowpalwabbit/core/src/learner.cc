@@ -4,25 +4,43 @@
 
 #include "vw/core/learner.h"
 
+#include "vw/common/vw_exception.h"
+#include "vw/config/options.h"
+#include "vw/core/global_data.h"
 #include "vw/core/parse_dispatch_loop.h"
 #include "vw/core/parse_regressor.h"
 #include "vw/core/parser.h"
+#include "vw/core/queue.h"
 #include "vw/core/reductions/conditional_contextual_bandit.h"
 #include "vw/core/vw.h"
 
+#include <exception>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
 namespace VW
 {
 namespace LEARNER
 {
+VW::details::profile_counter* finish_example_counter(VW::workspace& all)
+{
+  auto* profile = all.example_parser->profile.get();
+  return profile != nullptr ? &profile->finish_example : nullptr;
+}
+
 void learn_ex(example& ec, VW::workspace& all)
 {
   all.learn(ec);
+  VW::details::profile_scope timer(finish_example_counter(all));
   as_singleline(all.l)->finish_example(all, ec);
 }
 
 void learn_multi_ex(multi_ex& ec_seq, VW::workspace& all)
 {
   all.learn(ec_seq);
+  VW::details::profile_scope timer(finish_example_counter(all));
   as_multiline(all.l)->finish_example(all, ec_seq);
 }
 
@@ -111,6 +129,148 @@ private:
   std::vector<VW::workspace*> _all;
 };
 
+// Runs one of the secondary workspaces of generic_driver_parallel on its own thread. The examples it is handed are
+// copies taken from its own pool, so no example is ever touched by two learners.
+class instance_worker
+{
+public:
+  using job_fn = void (*)(multi_ex&, VW::workspace&);
+
+  instance_worker(VW::workspace& all, size_t max_queued_jobs)
+      : _all(all), _jobs(max_queued_jobs), _thread([this] { run(); })
+  {
+  }
+  instance_worker(const instance_worker&) = delete;
+  instance_worker& operator=(const instance_worker&) = delete;
+
+  ~instance_worker()
+  {
+    _jobs.set_done();
+    if (_thread.joinable()) { _thread.join(); }
+  }
+
+  VW::workspace& get_workspace() const { return _all; }
+
+  void push(multi_ex examples, job_fn fn)
+  {
+    job next;
+    next.examples = std::move(examples);
+    next.fn = fn;
+    _jobs.push(std::move(next));
+  }
+
+  // Waits for the queued examples to be learned and rethrows the first error raised by this learner.
+  void finish()
+  {
+    _jobs.set_done();
+    _thread.join();
+    if (_error) { std::rethrow_exception(_error); }
+  }
+
+private:
+  class job
+  {
+  public:
+    multi_ex examples;
+    job_fn fn = nullptr;
+  };
+
+  void run()
+  {
+    job next;
+    try
+    {
+      while (_jobs.try_pop(next)) { next.fn(next.examples, _all); }
+      _all.l->end_examples();
+    }
+    catch (...)
+    {
+      _error = std::current_exception();
+      // Keep consuming so that the producer never blocks on a full queue.
+      while (_jobs.try_pop(next)) { VW::finish_example(_all, next.examples); }
+    }
+  }
+
+  VW::workspace& _all;
+  VW::thread_safe_queue<job> _jobs;
+  std::exception_ptr _error;
+  std::thread _thread;
+};
+
+template <void (*process_impl)(example&, VW::workspace&)>
+void run_job(multi_ex& examples, VW::workspace& all)
+{
+  process_impl(*examples.front(), all);
+}
+
+template <void (*process_impl)(multi_ex&, VW::workspace&)>
+void run_job(multi_ex& examples, VW::workspace& all)
+{
+  process_impl(examples, all);
+}
+
+// Copy an example that went through setup_example on master into a fresh example of all, as if all had set it up.
+example* copy_for_instance(VW::workspace& master, VW::workspace& all, const example& src)
+{
+  auto& dst = get_unused_example(&all);
+  VW::copy_example_data_with_label(&dst, &src);
+  dst.ex_reduction_features = src.ex_reduction_features;
+  dst.interactions = &all.interactions;
+  dst.extent_interactions = &all.extent_interactions;
+
+  // Indices were scaled by the master's weights per problem and stride.
+  const uint64_t master_multiplier = static_cast<uint64_t>(master.wpp) << master.weights.stride_shift();
+  const uint64_t multiplier = static_cast<uint64_t>(all.wpp) << all.weights.stride_shift();
+  if (multiplier != master_multiplier)
+  {
+    for (features& fs : dst)
+    {
+      for (auto& j : fs.indices) { j = j / master_multiplier * multiplier; }
+    }
+  }
+  return &dst;
+}
+
+multi_ex copy_for_instance(VW::workspace& master, VW::workspace& all, const multi_ex& src)
+{
+  multi_ex copies;
+  copies.reserve(src.size());
+  for (const auto* ec : src) { copies.push_back(copy_for_instance(master, all, *ec)); }
+  return copies;
+}
+
+// Like multi_instance_context, but the master is the only instance run on the calling thread. Each other instance
+// learns on its own thread from copies of the master's examples, so parsing and setup happen once for all of them.
+class parallel_instance_context
+{
+public:
+  parallel_instance_context(VW::workspace& master, const std::vector<std::unique_ptr<instance_worker>>& workers)
+      : _master(master), _workers(workers)
+  {
+  }
+
+  VW::workspace& get_master() const { return _master; }
+
+  template <class T, void (*process_impl)(T&, VW::workspace&)>
+  void process(T& ec)
+  {
+    // The copies are made first as the master finishes, and so recycles, the examples it processes.
+    for (const auto& worker : _workers)
+    {
+      auto& all = worker->get_workspace();
+      worker->push(multi_ex_of(copy_for_instance(_master, all, ec)), &run_job<process_impl>);
+    }
+    process_impl(ec, _master);
+  }
+
+private:
+  static multi_ex multi_ex_of(example* ec) { return multi_ex{ec}; }
+  static multi_ex multi_ex_of(multi_ex&& examples) { return std::move(examples); }
+
+  VW::workspace& _master;
+  const std::vector<std::unique_ptr<instance_worker>>& _workers;
+};
+
 // single_example_handler / multi_example_handler - consumer classes with on_example handle method, incapsulating
 // creation of example / multi_ex and passing it to context.process
 template <typename context_type>
@@ -281,6 +441,81 @@ void generic_driver(const std::vector<VW::workspace*>& all)
   generic_driver(examples, context);
 }
 
+void generic_driver_parallel(const std::vector<VW::workspace*>& all)
+{
+  assert(!all.empty());
+  auto& master = *all.front();
+  std::vector<std::unique_ptr<instance_worker>> workers;
+  workers.reserve(all.size() - 1);
+  for (size_t i = 1; i < all.size(); ++i)
+  {
+    workers.push_back(VW::make_unique<instance_worker>(*all[i], master.example_parser->example_queue_limit));
+  }
+
+  parallel_instance_context context(master, workers);
+  ready_examples_queue examples(master);
+  generic_driver(examples, context);
+  for (auto& worker : workers) { worker->finish(); }
+}
+
+template <typename T>
+bool same_option_value(const VW::config::options_i& lhs, const VW::config::options_i& rhs, const std::string& name)
+{
+  if (lhs.was_supplied(name) != rhs.was_supplied(name)) { return false; }
+  return !lhs.was_supplied(name) || lhs.get_typed_option<T>(name).value() == rhs.get_typed_option<T>(name).value();
+}
+
+void check_multi_config_compatible(const VW::workspace& master, const VW::workspace& all, size_t config)
+{
+  const auto label_type = master.example_parser->lbl_parser.label_type;
+  if (all.example_parser->lbl_parser.label_type != label_type)
+  {
+    THROW("--multi_config: config " << config << " uses label type "
+                                    << VW::to_string(all.example_parser->lbl_parser.label_type)
+                                    << " but the first uses " << VW::to_string(label_type));
+  }
+  if (all.parse_mask != master.parse_mask || all.hash_seed != master.hash_seed)
+  {
+    THROW("--multi_config: config " << config << " must use the same --bit_precision and --hash_seed as the first");
+  }
+  if (all.example_parser->hasher != master.example_parser->hasher || all.chain_hash_json != master.chain_hash_json)
+  {
+    THROW("--multi_config: config " << config << " must use the same --hash and --chain_hash as the first");
+  }
+  if (all.add_constant != master.add_constant || all.permutations != master.permutations)
+  {
+    THROW("--multi_config: config " << config << " must agree with the first on --noconstant and --permutations");
+  }
+  if (all.example_parser->sort_features != master.example_parser->sort_features)
+  {
+    THROW("--multi_config: config " << config << " must agree with the first on --sort_features");
+  }
+  // The parser marks holdout examples as test only.
+  if (all.holdout_set_off != master.holdout_set_off || all.holdout_period != master.holdout_period ||
+      all.holdout_after != master.holdout_after)
+  {
+    THROW("--multi_config: config " << config << " must agree with the first on --holdout_off, --holdout_period and "
+                                    << "--holdout_after");
+  }
+  if (all.l->is_multiline() != master.l->is_multiline())
+  {
+    THROW("--multi_config: config " << config << " must be a multiline learner if and only if the first is");
+  }
+  // Feature generation happens while the first learner parses and sets up each example.
+  for (const char* name : {"ngram", "skips", "spelling", "ignore", "ignore_linear", "keep", "redefine", "feature_limit",
+           "dictionary", "dictionary_path"})
+  {
+    if (!same_option_value<std::vector<std::string>>(*master.options, *all.options, name))
+    {
+      THROW("--multi_config: config " << config << " must use the same --" << name << " as the first");
+    }
+  }
+  if (!same_option_value<std::string>(*master.options, *all.options, "affix"))
+  {
+    THROW("--multi_config: config " << config << " must use the same --affix as the first");
+  }
+}
+
 template <typename handler_type>
 void generic_driver_onethread(VW::workspace& all)
 {
@@ -339,50 +574,3 @@ void VW::LEARNER::details::learner_build_diagnostic(VW::string_view this_name, V
     THROW("cannot set both merge_with_all and merge_with_all_fn");
   }
 }
-void VW::LEARNER::details::debug_increment_depth(example& ex)
-{
-  if (vw_dbg::TRACK_STACK) { ++ex.debug_current_reduction_depth; }
-}
-void VW::LEARNER::details::debug_increment_depth(multi_ex& ec_seq)
-{
-  if (vw_dbg::TRACK_STACK)
-  {
-    for (auto& ec : ec_seq) { ++ec->debug_current_reduction_depth; }
-  }
-}
-void VW::LEARNER::details::debug_decrement_depth(example& ex)
-{
-  if (vw_dbg::TRACK_STACK) { --ex.debug_current_reduction_depth; }
-}
-void VW::LEARNER::details::debug_decrement_depth(multi_ex& ec_seq)
-{
-  if (vw_dbg::TRACK_STACK)
-  {
-    for (auto& ec : ec_seq) { --ec->debug_current_reduction_depth; }
-  }
-}
-void VW::LEARNER::details::increment_offset(example& ex, const size_t increment, const size_t i)
-{
-  ex.ft_offset += static_cast<uint32_t>(increment * i);
-  debug_increment_depth(ex);
-}
-void VW::LEARNER::details::increment_offset(multi_ex& ec_seq, const size_t increment, const size_t i)
-{
-  for (auto& ec : ec_seq) { ec->ft_offset += static_cast<uint32_t>(increment * i); }
-  debug_increment_depth(ec_seq);
-}
-void VW::LEARNER::details::decrement_offset(example& ex, const size_t increment, const size_t i)
-{
-  assert(ex.ft_offset >= increment * i);
-  ex.ft_offset -= static_cast<uint32_t>(increment * i);
-  debug_decrement_depth(ex);
-}
-void VW::LEARNER::details::decrement_offset(multi_ex& ec_seq, const size_t increment, const size_t i)
-{
-  for (auto ec : ec_seq)
-  {
-    assert(ec->ft_offset >= increment * i);
-    ec->ft_offset -= static_cast<uint32_t>(increment * i);
-  }
-  debug_decrement_depth(ec_seq);
-}
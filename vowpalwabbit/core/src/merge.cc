@@ -90,22 +90,6 @@ void validate_compatibility(const std::vector<const VW::workspace*>& workspaces,
   }
 }
 
-std::unique_ptr<VW::workspace> copy_workspace(const VW::workspace* ws, VW::io::logger* logger = nullptr)
-{
-  assert(ws != nullptr);
-  auto command_line = VW::split_command_line(get_keep_command_line(*ws));
-  if (logger == nullptr) { command_line.emplace_back("--quiet"); }
-  else { command_line.emplace_back("--driver_output_off"); }
-  command_line.emplace_back("--preserve_performance_counters");
-
-  auto backing_vector = std::make_shared<std::vector<char>>();
-  VW::io_buf temp_buffer;
-  temp_buffer.add_file(VW::io::create_vector_writer(backing_vector));
-  VW::save_predictor(*const_cast<VW::workspace*>(ws), temp_buffer);
-  return VW::initialize(VW::make_unique<VW::config::options_cli>(command_line),
-      VW::io::create_buffer_view(backing_vector->data(), backing_vector->size()), nullptr, nullptr, logger);
-}
-
 std::vector<float> calc_per_model_weighting(const std::vector<float>& example_counts)
 {
   const auto sum = std::accumulate(example_counts.begin(), example_counts.end(), 0.f);
@@ -160,12 +144,13 @@ std::unique_ptr<model_delta> model_delta::deserialize(VW::io::reader& input)
       VW::make_unique<VW::config::options_cli>(command_line), VW::make_unique<reader_ref_adapter>(input)));
 }
 
-VW::model_delta merge_deltas(const std::vector<const VW::model_delta*>& deltas_to_merge, VW::io::logger* logger)
+namespace
+{
+// Merges the workspaces into a new one. The sources are only read, so they can be the loaded models themselves rather
+// than copies.
+std::unique_ptr<VW::workspace> merge_workspaces(
+    const std::vector<const VW::workspace*>& workspaces_to_merge, VW::io::logger* logger)
 {
-  // Get workspace pointers from deltas
-  std::vector<const VW::workspace*> workspaces_to_merge;
-  workspaces_to_merge.reserve(deltas_to_merge.size());
-  for (const auto delta_ptr : deltas_to_merge) { workspaces_to_merge.push_back(delta_ptr->unsafe_get_workspace_ptr()); }
   validate_compatibility(workspaces_to_merge, logger);
 
   // Get VW command line and create output workspace
@@ -230,35 +215,34 @@ VW::model_delta merge_deltas(const std::vector<const VW::model_delta*>& deltas_t
     dest_workspace->sd->total_features += delta->sd->total_features;
   }
 
-  return VW::model_delta(std::move(dest_workspace));
+  return dest_workspace;
+}
+}  // namespace
+
+VW::model_delta merge_deltas(const std::vector<const VW::model_delta*>& deltas_to_merge, VW::io::logger* logger)
+{
+  // Get workspace pointers from deltas
+  std::vector<const VW::workspace*> workspaces_to_merge;
+  workspaces_to_merge.reserve(deltas_to_merge.size());
+  for (const auto delta_ptr : deltas_to_merge) { workspaces_to_merge.push_back(delta_ptr->unsafe_get_workspace_ptr()); }
+  return VW::model_delta(merge_workspaces(workspaces_to_merge, logger));
 }
 
 std::unique_ptr<VW::workspace> merge_models(const VW::workspace* base_workspace,
     const std::vector<const VW::workspace*>& workspaces_to_merge, VW::io::logger* logger)
 {
+  // Without a base the models are their own deltas and are merged in place, without copying them first.
+  if (base_workspace == nullptr) { return merge_workspaces(workspaces_to_merge, logger); }
+
   std::vector<VW::model_delta> deltas;
   deltas.reserve(workspaces_to_merge.size());
-
-  if (base_workspace != nullptr)
-  {
-    for (const auto* ws : workspaces_to_merge) { deltas.emplace_back(*ws - *base_workspace); }
-  }
-  else
-  {
-    for (const auto* ws : workspaces_to_merge)
-    {
-      // No base workspace to subtract, but we must make a copy of workspace to give delta ownership of it
-      deltas.emplace_back(copy_workspace(ws, logger));
-    }
-  }
+  for (const auto* ws : workspaces_to_merge) { deltas.emplace_back(*ws - *base_workspace); }
 
   std::vector<const VW::model_delta*> delta_ptrs;
   delta_ptrs.reserve(deltas.size());
   for (const auto& d : deltas) { delta_ptrs.push_back(&d); }
   VW::model_delta merged = merge_deltas(delta_ptrs, logger);
-
-  if (base_workspace != nullptr) { return *base_workspace + merged; }
-  return std::unique_ptr<VW::workspace>(merged.unsafe_release_workspace_ptr());
+  return *base_workspace + merged;
 }
 }  // namespace VW
 
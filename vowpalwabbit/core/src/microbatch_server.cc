@@ -0,0 +1,286 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/microbatch_server.h"
+
+#include "vw/common/vw_exception.h"
+#include "vw/core/global_data.h"
+#include "vw/core/learner.h"
+#include "vw/core/parser.h"
+#include "vw/core/vw.h"
+#include "vw/text_parser/parse_example_text.h"
+
+#include <algorithm>
+#include <exception>
+
+namespace
+{
+// Enough samples for a stable p99 without keeping every request of a long running server.
+constexpr size_t MAX_LATENCY_SAMPLES = 1 << 16;
+
+// polyprediction is move only, and the example keeps its own to be reused. Copy the member the learner writes.
+VW::polyprediction copy_prediction(const VW::polyprediction& src, VW::prediction_type_t type)
+{
+  VW::polyprediction dst;
+  switch (type)
+  {
+    case VW::prediction_type_t::SCALAR:
+      dst.scalar = src.scalar;
+      break;
+    case VW::prediction_type_t::SCALARS:
+    case VW::prediction_type_t::MULTICLASS_PROBS:
+      dst.scalars = src.scalars;
+      break;
+    case VW::prediction_type_t::ACTION_SCORES:
+    case VW::prediction_type_t::ACTION_PROBS:
+      dst.a_s = src.a_s;
+      break;
+    case VW::prediction_type_t::PDF:
+      dst.pdf = src.pdf;
+      break;
+    case VW::prediction_type_t::MULTICLASS:
+      dst.multiclass = src.multiclass;
+      break;
+    case VW::prediction_type_t::MULTILABELS:
+      dst.multilabels.label_v = src.multilabels.label_v;
+      break;
+    case VW::prediction_type_t::PROB:
+      dst.prob = src.prob;
+      break;
+    case VW::prediction_type_t::DECISION_PROBS:
+      dst.decision_scores = src.decision_scores;
+      break;
+    case VW::prediction_type_t::ACTION_PDF_VALUE:
+      dst.pdf_value = src.pdf_value;
+      break;
+    case VW::prediction_type_t::ACTIVE_MULTICLASS:
+      dst.active_multiclass.predicted_class = src.active_multiclass.predicted_class;
+      dst.active_multiclass.more_info_required_for_classes = src.active_multiclass.more_info_required_for_classes;
+      break;
+    case VW::prediction_type_t::NOPRED:
+      break;
+  }
+  return dst;
+}
+
+size_t queue_depth_bucket(size_t depth)
+{
+  size_t bucket = 0;
+  while (depth >>= 1) { bucket++; }
+  return bucket;
+}
+
+std::chrono::nanoseconds percentile(std::vector<uint64_t>& samples, double p)
+{
+  if (samples.empty()) { return std::chrono::nanoseconds{0}; }
+  auto nth = samples.begin() + static_cast<std::ptrdiff_t>(p * static_cast<double>(samples.size() - 1));
+  std::nth_element(samples.begin(), nth, samples.end());
+  return std::chrono::nanoseconds{*nth};
+}
+}  // namespace
+
+VW::microbatch_server::microbatch_server(VW::workspace& all, microbatch_server_options options)
+    : _all(all), _options(options)
+{
+  if (_options.max_batch_size == 0) { THROW("microbatch_server needs a max_batch_size of at least 1"); }
+  if (_options.max_queue_size == 0) { THROW("microbatch_server needs a max_queue_size of at least 1"); }
+
+  _batch.reserve(_options.max_batch_size);
+  _batch_examples.resize(_options.max_batch_size);
+  _latencies_ns.reserve(MAX_LATENCY_SAMPLES);
+  _batch_sizes.resize(_options.max_batch_size + 1);
+  _queue_depths.resize(queue_depth_bucket(_options.max_queue_size) + 1);
+  _thread = std::thread(&microbatch_server::run, this);
+}
+
+VW::microbatch_server::~microbatch_server()
+{
+  {
+    std::lock_guard<std::mutex> lock(_queue_mutex);
+    _done = true;
+  }
+  _has_requests.notify_one();
+  _thread.join();
+}
+
+std::future<VW::polyprediction> VW::microbatch_server::predict(std::string request)
+{
+  return submit(std::move(request), false);
+}
+
+std::future<VW::polyprediction> VW::microbatch_server::learn(std::string request)
+{
+  return submit(std::move(request), true);
+}
+
+std::future<VW::polyprediction> VW::microbatch_server::submit(std::string text, bool learn)
+{
+  request req;
+  req.text = std::move(text);
+  req.learn = learn;
+  auto answer = req.answer.get_future();
+
+  std::unique_lock<std::mutex> lock(_queue_mutex);
+  _has_room.wait(lock, [this] { return _queue.size() < _options.max_queue_size; });
+  req.submitted = std::chrono::steady_clock::now();
+  _queue.push_back(std::move(req));
+  // The server only needs waking to start a batch or to run one that filled up before its deadline.
+  const auto queued = _queue.size();
+  lock.unlock();
+  if (queued == 1 || queued == _options.max_batch_size) { _has_requests.notify_one(); }
+  return answer;
+}
+
+void VW::microbatch_server::run()
+{
+  std::unique_lock<std::mutex> lock(_queue_mutex);
+  while (true)
+  {
+    _has_requests.wait(lock, [this] { return _done || !_queue.empty(); });
+    if (_queue.empty()) { return; }
+
+    // When shutting down the queue is drained without waiting for batches to fill up.
+    const auto deadline = _queue.front().submitted + _options.latency_budget;
+    _has_requests.wait_until(
+        lock, deadline, [this] { return _done || _queue.size() >= _options.max_batch_size; });
+
+    const auto queue_depth = _queue.size();
+    const auto batch_size = std::min(queue_depth, _options.max_batch_size);
+    for (size_t i = 0; i < batch_size; i++)
+    {
+      _batch.push_back(std::move(_queue.front()));
+      _queue.pop_front();
+    }
+    lock.unlock();
+    _has_room.notify_all();
+
+    run_batch(queue_depth);
+    _batch.clear();
+    lock.lock();
+  }
+}
+
+void VW::microbatch_server::parse_request(const request& req, VW::multi_ex& examples)
+{
+  if (_all.l->is_multiline())
+  {
+    VW::parsers::text::read_lines(&_all, req.text, examples);
+    if (examples.empty()) { THROW("microbatch_server received an empty request"); }
+    VW::setup_examples(_all, examples);
+  }
+  else
+  {
+    if (req.text.find('\n') != std::string::npos)
+    {
+      THROW("microbatch_server requests for single-line learners must contain exactly one example");
+    }
+    examples.push_back(&VW::get_unused_example(&_all));
+    VW::parsers::text::read_line(_all, examples[0], req.text);
+    VW::setup_example(_all, examples[0]);
+  }
+}
+
+void VW::microbatch_server::run_batch(size_t queue_depth)
+{
+  const bool is_multiline = _all.l->is_multiline();
+  const auto prediction_type = _all.l->get_output_prediction_type();
+  record_batch(queue_depth);
+
+  // Parse and set up the whole batch first, so that the learner then runs its examples back to back.
+  for (size_t i = 0; i < _batch.size(); i++)
+  {
+    auto& examples = _batch_examples[i];
+    try
+    {
+      parse_request(_batch[i], examples);
+    }
+    catch (...)
+    {
+      record_answer(_batch[i]);
+      _batch[i].answer.set_exception(std::current_exception());
+      VW::finish_example(_all, examples);
+      examples.clear();
+    }
+  }
+
+  for (size_t i = 0; i < _batch.size(); i++)
+  {
+    auto& examples = _batch_examples[i];
+    if (examples.empty()) { continue; }
+
+    VW::polyprediction prediction;
+    std::exception_ptr error;
+    try
+    {
+      if (is_multiline)
+      {
+        if (_batch[i].learn) { _all.learn(examples); }
+        else { _all.predict(examples); }
+      }
+      else
+      {
+        if (_batch[i].learn) { _all.learn(*examples[0]); }
+        else { _all.predict(*examples[0]); }
+      }
+      prediction = copy_prediction(examples[0]->pred, prediction_type);
+    }
+    catch (...)
+    {
+      error = std::current_exception();
+    }
+
+    if (error)
+    {
+      VW::finish_example(_all, examples);
+      record_answer(_batch[i]);
+      _batch[i].answer.set_exception(error);
+    }
+    else
+    {
+      if (is_multiline) { _all.finish_example(examples); }
+      else { _all.finish_example(*examples[0]); }
+      record_answer(_batch[i]);
+      _batch[i].answer.set_value(std::move(prediction));
+    }
+    examples.clear();
+  }
+}
+
+void VW::microbatch_server::record_batch(size_t queue_depth)
+{
+  std::lock_guard<std::mutex> lock(_stats_mutex);
+  _batches++;
+  _batch_sizes[_batch.size()]++;
+  _queue_depths[queue_depth_bucket(queue_depth)]++;
+}
+
+// Recorded before the answer is set, so that the stats already include a request once its caller has the answer.
+void VW::microbatch_server::record_answer(const request& req)
+{
+  const auto latency = static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - req.submitted).count());
+
+  std::lock_guard<std::mutex> lock(_stats_mutex);
+  _requests++;
+  if (_latencies_ns.size() < MAX_LATENCY_SAMPLES) { _latencies_ns.push_back(latency); }
+  else { _latencies_ns[_next_latency] = latency; }
+  _next_latency = (_next_latency + 1) % MAX_LATENCY_SAMPLES;
+}
+
+VW::microbatch_server_stats VW::microbatch_server::stats() const
+{
+  microbatch_server_stats result;
+  std::vector<uint64_t> latencies;
+  {
+    std::lock_guard<std::mutex> lock(_stats_mutex);
+    result.requests = _requests;
+    result.batches = _batches;
+    result.batch_sizes = _batch_sizes;
+    result.queue_depths = _queue_depths;
+    latencies = _latencies_ns;
+  }
+  result.p50_latency = percentile(latencies, 0.5);
+  result.p99_latency = percentile(latencies, 0.99);
+  return result;
+}
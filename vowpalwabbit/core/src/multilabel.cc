@@ -43,7 +43,7 @@ void parse_label(VW::multilabel_label& ld, VW::label_parser_reuse_mem& reuse_mem
 }
 }  // namespace
 
-void VW::multilabel_label::reset_to_default() { label_v.clear(); }
+void VW::multilabel_label::reset_to_default() { label_v.clear_noshrink(); }
 
 bool VW::multilabel_label::is_test() const { return label_v.empty(); }
 
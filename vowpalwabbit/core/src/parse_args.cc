@@ -123,6 +123,23 @@ void VW::details::parse_dictionary_argument(VW::workspace& all, const std::strin
   std::string file_name = find_in_path(all.dictionary_path, std::string(s));
   if (file_name.empty()) THROW("error: cannot find dictionary '" << s << "' in path; try adding --dictionary_path")
 
+  if (VW::details::flat_dictionary::is_flat_dictionary_file(file_name))
+  {
+    auto flat = VW::details::flat_dictionary::load(file_name);
+    if (flat->hash_seed() != all.hash_seed)
+    {
+      THROW("error: flat dictionary '" << file_name << "' was written with --hash_seed " << flat->hash_seed()
+                                       << " but this model uses " << all.hash_seed)
+    }
+    if (!all.quiet)
+    {
+      *(all.trace_message) << "mapped flat dictionary '" << s << "' with " << flat->size() << " item"
+                           << (flat->size() == 1 ? "" : "s") << endl;
+    }
+    all.namespace_flat_dictionaries[static_cast<size_t>(ns)].push_back(std::move(flat));
+    return;
+  }
+
   bool is_gzip = VW::ends_with(file_name, ".gz");
   std::unique_ptr<VW::io::reader> file_adapter;
   try
@@ -238,6 +255,13 @@ void VW::details::parse_dictionary_argument(VW::workspace& all, const std::strin
                          << (map->size() == 1 ? "" : "s") << endl;
   }
 
+  if (all.save_flat_dictionaries)
+  {
+    const auto flat_file_name = file_name + ".vwdict";
+    VW::details::flat_dictionary::save(*map, all.hash_seed, flat_file_name);
+    if (!all.quiet) { *(all.trace_message) << "wrote flat dictionary '" << flat_file_name << "'" << endl; }
+  }
+
   all.namespace_dictionaries[static_cast<size_t>(ns)].push_back(map);
   details::dictionary_info info = {std::string{s}, fd_hash, map};
   all.loaded_dictionaries.push_back(info);
@@ -405,7 +429,13 @@ VW::details::input_options parse_source(VW::workspace& all, options_i& options)
                      "hashed as A^B^C."))
       .add(make_option("flatbuffer", parsed_options.flatbuffer)
                .help("Data file will be interpreted as a flatbuffer file")
-               .experimental());
+               .experimental())
+      .add(make_option("in_memory_passes", parsed_options.in_memory_passes)
+               .help("Keep the examples of the first pass in memory and replay them in later passes. Does not need a "
+                     "cache file"))
+      .add(make_option("in_memory_shuffle", parsed_options.in_memory_shuffle)
+               .help("Shuffle the replayed examples on every pass after the first, seeded by --random_seed. Requires "
+                     "--in_memory_passes"));
 #ifdef VW_BUILD_CSV
   parsed_options.csv_opts = VW::make_unique<VW::parsers::csv::csv_parser_options>();
   VW::parsers::csv::csv_parser::set_parse_args(input_options, *parsed_options.csv_opts);
@@ -438,6 +468,16 @@ VW::details::input_options parse_source(VW::workspace& all, options_i& options)
     all.numpasses = static_cast<size_t>(1e5);
   }
 
+  if (parsed_options.in_memory_shuffle && !parsed_options.in_memory_passes)
+  {
+    THROW("--in_memory_shuffle requires --in_memory_passes")
+  }
+  if (parsed_options.in_memory_passes && all.daemon) { THROW("--in_memory_passes is incompatible with daemon mode") }
+  if (parsed_options.in_memory_passes && options.was_supplied("initial_pass_length"))
+  {
+    THROW("--in_memory_passes is incompatible with --initial_pass_length")
+  }
+
   // Add an implicit cache file based on the data filename.
   if (parsed_options.cache) { parsed_options.cache_files.push_back(all.data_filename + ".cache"); }
 
@@ -595,6 +635,9 @@ void parse_feature_tweaks(options_i& options, VW::workspace& all, bool interacti
       .add(make_option("dictionary", dictionary_nses)
                .keep()
                .help("Read a dictionary for additional features (arg either 'x:file' or just 'file')"))
+      .add(make_option("save_flat_dictionaries", all.save_flat_dictionaries)
+               .help("Also write every text dictionary loaded with --dictionary as a memory mapped flat dictionary "
+                     "'<file>.vwdict', which later runs can pass to --dictionary instead"))
       .add(make_option("dictionary_path", dictionary_path)
                .help("Look in this directory for dictionaries; defaults to current directory or env{PATH}"))
       .add(make_option("interactions", interactions)
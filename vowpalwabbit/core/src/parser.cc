@@ -638,8 +638,14 @@ void VW::details::enable_sources(
     }
   }
 
-  if (passes > 1 && !all.example_parser->resettable)
-    THROW("need a cache file for multiple passes : try using  --cache or --cache_file <name>");
+  if (passes > 1 && input_options.in_memory_passes)
+  {
+    all.example_parser->replay_buffer = VW::make_unique<VW::details::example_replay_buffer>(
+        input_options.in_memory_shuffle, all.get_random_state()->get_current_state());
+  }
+
+  if (passes > 1 && !all.example_parser->resettable && all.example_parser->replay_buffer == nullptr)
+    THROW("need a cache file for multiple passes : try using  --cache or --cache_file <name> or --in_memory_passes");
 
   if (!quiet && !all.daemon)
   {
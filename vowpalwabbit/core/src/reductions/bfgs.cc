@@ -8,6 +8,7 @@ Implementation by Miro Dudik.
  */
 #include "vw/core/reductions/bfgs.h"
 
+#include "vw/allreduce/allreduce.h"
 #include "vw/common/vw_exception.h"
 #include "vw/core/accumulate.h"
 #include "vw/core/learner.h"
@@ -19,6 +20,7 @@ Implementation by Miro Dudik.
 #include "vw/core/setup_base.h"
 #include "vw/core/shared_data.h"
 #include "vw/core/simple_label.h"
+#include "vw/core/thread_pool.h"
 
 #include <sys/timeb.h>
 
@@ -30,6 +32,9 @@ Implementation by Miro Dudik.
 #include <cstring>
 #include <exception>
 #include <fstream>
+#include <future>
+#include <memory>
+#include <vector>
 
 #ifndef _WIN32
 #  include <netdb.h>
@@ -71,6 +76,33 @@ class curv_exception : public std::exception
 
 constexpr float MAX_PRECOND_RATIO = 10000.f;
 
+// Compact copy of the examples seen in the first pass, used by --bfgs_in_memory to run the remaining passes
+// without going back to the parser. Interactions are already expanded, so each feature is stored as the weight slot
+// it touches ((index & mask) >> stride_shift) and its value. Example i owns [offsets[i], offsets[i + 1]).
+class bfgs_in_memory_data
+{
+public:
+  std::vector<size_t> offsets{0};
+  std::vector<uint32_t> slots;
+  std::vector<float> values;
+  std::vector<float> labels;
+  std::vector<float> weights;
+  std::vector<float> initials;
+  // Per example loss of the pass being replayed, folded into shared_data in example order afterwards.
+  std::vector<float> losses;
+
+  size_t size() const { return labels.size(); }
+  size_t num_features(size_t i) const { return offsets[i + 1] - offsets[i]; }
+};
+
+class bfgs_in_memory_collector
+{
+public:
+  bfgs_in_memory_data* data;
+  uint64_t mask;
+  uint32_t stride_shift;
+};
+
 class bfgs
 {
 public:
@@ -119,6 +151,19 @@ public:
   bool gradient_pass = false;
   bool preconditioner_pass = false;
 
+  // --bfgs_in_memory: training and holdout examples of the first pass. Holdout examples are kept apart so that
+  // predictions stays indexed by training example.
+  bool in_memory = false;
+  bfgs_in_memory_data in_memory_train;
+  bfgs_in_memory_data in_memory_holdout;
+  // Replayed passes are split into one contiguous block of examples per thread. With more than one thread each block
+  // accumulates its gradient into its own buffer and the buffers are summed with all_reduce_threads.
+  std::unique_ptr<VW::thread_pool> replay_pool;
+  std::vector<std::unique_ptr<VW::all_reduce_threads>> replay_reducers;
+  std::vector<std::vector<float>> replay_gradients;
+  std::vector<double> replay_partial_sums;
+  std::vector<std::future<void>> replay_futures;
+
   ~bfgs()
   {
     free(mem);
@@ -198,6 +243,137 @@ float dot_with_direction(VW::workspace& all, VW::example& ec)
   return temp;
 }
 
+inline void remember_feature(bfgs_in_memory_collector& c, float x, uint64_t index)
+{
+  c.data->slots.push_back(static_cast<uint32_t>((index & c.mask) >> c.stride_shift));
+  c.data->values.push_back(x);
+}
+
+void remember_example(VW::workspace& all, bfgs_in_memory_data& data, VW::example& ec)
+{
+  bfgs_in_memory_collector c{&data, all.weights.mask(), all.weights.stride_shift()};
+  VW::foreach_feature<bfgs_in_memory_collector, uint64_t, remember_feature>(all, ec, c);
+  data.offsets.push_back(data.slots.size());
+  data.labels.push_back(ec.l.simple.label);
+  data.weights.push_back(ec.weight);
+  data.initials.push_back(ec.ex_reduction_features.template get<VW::simple_label_reduction_features>().initial);
+}
+
+inline float in_memory_dot(
+    const bfgs_in_memory_data& data, VW::dense_parameters& weights, size_t i, float initial, size_t offset)
+{
+  const uint32_t stride_shift = weights.stride_shift();
+  float ret = initial;
+  for (size_t j = data.offsets[i]; j < data.offsets[i + 1]; ++j)
+  {
+    ret += data.values[j] * (&weights[static_cast<uint64_t>(data.slots[j]) << stride_shift])[offset];
+  }
+  return ret;
+}
+
+// Gradient (or curvature) computation of process_example for examples [begin, end) of the in-memory training set.
+// When grad is null the gradient is added straight to W_GT, otherwise to grad, indexed by weight slot.
+double replay_block(VW::workspace& all, bfgs& b, size_t begin, size_t end, float* grad)
+{
+  auto& data = b.in_memory_train;
+  auto& weights = all.weights.dense_weights;
+  const uint32_t stride_shift = weights.stride_shift();
+  double sum = 0.;
+  for (size_t i = begin; i < end; ++i)
+  {
+    const float label = data.labels[i];
+    const float weight = data.weights[i];
+    if (b.gradient_pass)
+    {
+      const float fp = VW::details::finalize_prediction(
+          all.sd, all.logger, in_memory_dot(data, weights, i, data.initials[i], W_XT));
+      const float loss_grad = all.loss->first_derivative(all.sd, fp, label) * weight;
+      for (size_t j = data.offsets[i]; j < data.offsets[i + 1]; ++j)
+      {
+        if (grad != nullptr) { grad[data.slots[j]] += loss_grad * data.values[j]; }
+        else { (&weights[static_cast<uint64_t>(data.slots[j]) << stride_shift])[W_GT] += loss_grad * data.values[j]; }
+      }
+      b.predictions[i] = fp;
+      data.losses[i] = all.loss->get_loss(all.sd, fp, label) * weight;
+      sum += data.losses[i];
+    }
+    else
+    {
+      const float d_dot_x = in_memory_dot(data, weights, i, data.initials[i], W_DIR);
+      data.losses[i] = all.loss->get_loss(all.sd, b.predictions[i], label) * weight;
+      const float sd = all.loss->second_derivative(all.sd, b.predictions[i], label);
+      sum += (static_cast<double>(d_dot_x)) * d_dot_x * sd * weight;
+    }
+  }
+  return sum;
+}
+
+static void add_float(float& c1, const float& c2) { c1 += c2; }
+
+// Runs one pass of process_example over the examples kept by --bfgs_in_memory instead of the parser.
+void replay_pass(VW::workspace& all, bfgs& b)
+{
+  auto& data = b.in_memory_train;
+  const size_t num_examples = data.size();
+  data.losses.resize(num_examples);
+  if (b.gradient_pass) { b.predictions.resize(num_examples); }
+
+  const size_t num_blocks = b.replay_partial_sums.size();
+  if (num_blocks == 1) { b.replay_partial_sums[0] = replay_block(all, b, 0, num_examples, nullptr); }
+  else
+  {
+    const size_t num_slots = (all.weights.mask() + 1) >> all.weights.stride_shift();
+    b.replay_futures.clear();
+    for (size_t t = 0; t < num_blocks; ++t)
+    {
+      b.replay_futures.emplace_back(b.replay_pool->submit(
+          [&all, &b, num_examples, num_blocks, num_slots](size_t block)
+          {
+            const size_t begin = num_examples * block / num_blocks;
+            const size_t end = num_examples * (block + 1) / num_blocks;
+            auto& grad = b.replay_gradients[block];
+            b.replay_partial_sums[block] = replay_block(all, b, begin, end, grad.data());
+            if (!b.gradient_pass) { return; }
+
+            // After the reduction every buffer holds the full gradient, each thread folds its share of the slots
+            // into W_GT and clears its own buffer for the next pass.
+            b.replay_reducers[block]->all_reduce<float, add_float>(grad.data(), num_slots);
+            auto& weights = all.weights.dense_weights;
+            const size_t slot_begin = num_slots * block / num_blocks;
+            const size_t slot_end = num_slots * (block + 1) / num_blocks;
+            for (size_t slot = slot_begin; slot < slot_end; ++slot)
+            {
+              (&weights[static_cast<uint64_t>(slot) << weights.stride_shift()])[W_GT] += grad[slot];
+            }
+            std::fill(grad.begin(), grad.end(), 0.f);
+          },
+          t));
+    }
+    for (auto& f : b.replay_futures) { f.get(); }
+  }
+
+  double sum = 0.;
+  for (double partial : b.replay_partial_sums) { sum += partial; }
+  if (b.gradient_pass) { b.loss_sum += sum; }
+  else { b.curvature += sum; }
+
+  for (size_t i = 0; i < num_examples; ++i)
+  {
+    all.sd->update(false, true, data.losses[i], data.weights[i], data.num_features(i));
+    all.sd->weighted_labels += static_cast<double>(data.labels[i]) * data.weights[i];
+  }
+
+  // Holdout examples only need a prediction for the holdout loss.
+  auto& holdout = b.in_memory_holdout;
+  for (size_t i = 0; i < holdout.size(); ++i)
+  {
+    const float fp = VW::details::finalize_prediction(
+        all.sd, all.logger, in_memory_dot(holdout, all.weights.dense_weights, i, holdout.initials[i], W_XT));
+    const float loss = all.loss->get_loss(all.sd, fp, holdout.labels[i]) * holdout.weights[i];
+    all.sd->update(true, true, loss, holdout.weights[i], holdout.num_features(i));
+  }
+}
+
 template <class T>
 double regularizer_direction_magnitude(VW::workspace& /* all */, bfgs& b, double regularizer, T& weights)
 {
@@ -916,7 +1092,7 @@ void process_example(VW::workspace& all, bfgs& b, VW::example& ec)
   }
 }
 
-void end_pass(bfgs& b)
+void finish_pass(bfgs& b)
 {
   VW::workspace* all = b.all;
 
@@ -976,6 +1152,25 @@ void end_pass(bfgs& b)
   }
 }
 
+void end_pass(bfgs& b)
+{
+  VW::workspace* all = b.all;
+  finish_pass(b);
+
+  // The parser stops after the first pass with --bfgs_in_memory, the remaining passes are replayed here.
+  if (b.in_memory && b.current_pass == 1)
+  {
+    while (b.current_pass < b.final_pass && !all->early_terminate)
+    {
+      replay_pass(*all, b);
+      all->current_pass++;
+      finish_pass(b);
+    }
+    b.in_memory_train = bfgs_in_memory_data{};
+    b.in_memory_holdout = bfgs_in_memory_data{};
+  }
+}
+
 // placeholder
 template <bool audit>
 void predict(bfgs& b, base_learner&, VW::example& ec)
@@ -983,6 +1178,10 @@ void predict(bfgs& b, base_learner&, VW::example& ec)
   VW::workspace* all = b.all;
   ec.pred.scalar = bfgs_predict(*all, ec);
   if (audit) { VW::details::print_audit_features(*(b.all), ec); }
+  if (b.in_memory && b.current_pass == 0 && ec.test_only && all->training && !test_example(ec))
+  {
+    remember_example(*all, b.in_memory_holdout, ec);
+  }
 }
 
 template <bool audit>
@@ -993,7 +1192,11 @@ void learn(bfgs& b, base_learner& base, VW::example& ec)
   if (b.current_pass <= b.final_pass)
   {
     if (test_example(ec)) { predict<audit>(b, base, ec); }
-    else { process_example(*all, b, ec); }
+    else
+    {
+      if (b.in_memory && b.current_pass == 0) { remember_example(*all, b.in_memory_train, ec); }
+      process_example(*all, b, ec);
+    }
   }
 }
 
@@ -1126,12 +1329,20 @@ base_learner* VW::reductions::bfgs_setup(VW::setup_base_i& stack_builder)
   int local_m = 0;
   float local_rel_threshold = 0.f;
   bool local_hessian_on = false;
+  bool in_memory = false;
+  uint64_t replay_threads = 0;
   option_group_definition bfgs_options("[Reduction] LBFGS and Conjugate Gradient");
   bfgs_options.add(
       make_option("bfgs", bfgs_option).keep().necessary().help("Use conjugate gradient based optimization"));
   bfgs_options.add(make_option("hessian_on", local_hessian_on).help("Use second derivative in line search"));
   bfgs_options.add(make_option("mem", local_m).default_value(15).help("Memory in bfgs"));
   bfgs_options.add(make_option("termination", local_rel_threshold).default_value(0.001f).help("Termination threshold"));
+  bfgs_options.add(make_option("bfgs_in_memory", in_memory)
+                       .help("Keep the examples of the first pass in memory and run the remaining passes over them "
+                             "instead of the cache file. Predictions are only output during the first pass"));
+  bfgs_options.add(make_option("bfgs_threads", replay_threads)
+                       .default_value(1)
+                       .help("Number of threads used for the passes run by --bfgs_in_memory"));
 
   auto conjugate_gradient_enabled = options.add_parse_and_check_necessary(conjugate_gradient_options);
   auto bfgs_enabled = options.add_parse_and_check_necessary(bfgs_options);
@@ -1174,6 +1385,30 @@ base_learner* VW::reductions::bfgs_setup(VW::setup_base_i& stack_builder)
 
   if (all.numpasses < 2 && all.training) { THROW("At least 2 passes must be used for BFGS"); }
 
+  if (in_memory && all.training)
+  {
+    if (all.weights.sparse) { THROW("--bfgs_in_memory cannot be used with --sparse_weights"); }
+    if (all.num_bits > 32) { THROW("--bfgs_in_memory requires -b 32 or less"); }
+    if (replay_threads == 0) { THROW("--bfgs_threads must be at least 1"); }
+    b->in_memory = true;
+    // Only the first pass comes from the parser.
+    all.numpasses = 1;
+    const size_t num_threads = static_cast<size_t>(replay_threads);
+    b->replay_partial_sums.resize(num_threads);
+    if (num_threads > 1)
+    {
+      b->replay_pool = VW::make_unique<VW::thread_pool>(num_threads);
+      const size_t num_slots = size_t(1) << all.num_bits;
+      b->replay_gradients.resize(num_threads, std::vector<float>(num_slots, 0.f));
+      b->replay_reducers.emplace_back(VW::make_unique<VW::all_reduce_threads>(num_threads, 0, true));
+      for (size_t t = 1; t < num_threads; ++t)
+      {
+        b->replay_reducers.emplace_back(
+            VW::make_unique<VW::all_reduce_threads>(b->replay_reducers[0].get(), num_threads, t, true));
+      }
+    }
+  }
+
   all.bfgs = true;
   all.weights.stride_shift(2);
 
@@ -38,6 +38,7 @@ public:
   uint32_t num_bootstrap_rounds = 0;  // number of bootstrap rounds
   size_t bs_type = 0;
   std::vector<double> pred_vec;
+  std::vector<VW::polyprediction> round_preds;  // for scoring all rounds in one multipredict call
   VW::workspace* all = nullptr;  // for raw prediction and loss
   std::shared_ptr<VW::rand_state> random_state;
 };
@@ -179,23 +180,36 @@ void predict_or_learn(bs_data& d, single_learner& base, VW::example& ec)
   std::stringstream output_string_stream;
   d.pred_vec.clear();
 
-  for (size_t i = 1; i <= d.num_bootstrap_rounds; i++)
+  // Raw output needs the partial prediction of every round, which multipredict does not report
+  if (!is_learn && !should_output)
   {
-    ec.weight = weight_temp * static_cast<float>(bs::weight_gen(*d.random_state));
+    // Keep the draws so that the random state advances exactly as it does when predicting round by round
+    for (size_t i = 1; i <= d.num_bootstrap_rounds; i++) { bs::weight_gen(*d.random_state); }
 
-    if (is_learn) { base.learn(ec, i - 1); }
-    else { base.predict(ec, i - 1); }
+    d.round_preds.resize(d.num_bootstrap_rounds);
+    base.multipredict(ec, 0, d.num_bootstrap_rounds, d.round_preds.data(), true);
+    for (const auto& round_pred : d.round_preds) { d.pred_vec.push_back(round_pred.scalar); }
+  }
+  else
+  {
+    for (size_t i = 1; i <= d.num_bootstrap_rounds; i++)
+    {
+      ec.weight = weight_temp * static_cast<float>(bs::weight_gen(*d.random_state));
 
-    d.pred_vec.push_back(ec.pred.scalar);
+      if (is_learn) { base.learn(ec, i - 1); }
+      else { base.predict(ec, i - 1); }
 
-    if (should_output)
-    {
-      if (i > 1) { output_string_stream << ' '; }
-      output_string_stream << i << ':' << ec.partial_prediction;
+      d.pred_vec.push_back(ec.pred.scalar);
+
+      if (should_output)
+      {
+        if (i > 1) { output_string_stream << ' '; }
+        output_string_stream << i << ':' << ec.partial_prediction;
+      }
     }
-  }
 
-  ec.weight = weight_temp;
+    ec.weight = weight_temp;
+  }
 
   switch (d.bs_type)
   {
@@ -119,7 +119,7 @@ void VW::reductions::cb_adf::learn_sm(multi_learner& base, VW::multi_ex& example
 
   for (uint32_t i = 0; i < examples.size(); i++)
   {
-    VW::cb_label ld = examples[i]->l.cb;
+    const auto& ld = examples[i]->l.cb;
     if (ld.costs.size() == 1 && ld.costs[0].cost != FLT_MAX)
     {
       chosen_action = i;
@@ -266,6 +266,15 @@ void VW::reductions::cb_adf::predict(multi_learner& base, VW::multi_ex& ec_seq)
   details::cs_ldf_learn_or_predict<false>(base, ec_seq, _cb_labels, _cs_labels, _prepped_cs_labels, false, _offset);
 }
 
+void VW::reductions::cb_adf::multipredict(
+    multi_learner& base, VW::multi_ex& ec_seq, size_t count, VW::polyprediction* pred)
+{
+  _offset = ec_seq[0]->ft_offset;
+  gen_cs.known_cost = VW::get_observed_cost_or_default_cb_adf(ec_seq);
+  details::gen_cs_test_example(ec_seq, _cs_labels);
+  details::cs_ldf_multipredict(base, ec_seq, _cb_labels, _cs_labels, _prepped_cs_labels, _offset, 0, count, pred);
+}
+
 // how to
 
 bool VW::reductions::cb_adf::update_statistics(
@@ -374,6 +383,12 @@ void learn(VW::reductions::cb_adf& c, multi_learner& base, VW::multi_ex& ec_seq)
 
 void predict(VW::reductions::cb_adf& c, multi_learner& base, VW::multi_ex& ec_seq) { c.predict(base, ec_seq); }
 
+void multipredict(VW::reductions::cb_adf& c, multi_learner& base, VW::multi_ex& ec_seq, size_t count, size_t /* step */,
+    VW::polyprediction* pred, bool /* finalize_predictions */)
+{
+  c.multipredict(base, ec_seq, count, pred);
+}
+
 }  // namespace
 VW::LEARNER::base_learner* VW::reductions::cb_adf_setup(VW::setup_base_i& stack_builder)
 {
@@ -464,6 +479,8 @@ VW::LEARNER::base_learner* VW::reductions::cb_adf_setup(VW::setup_base_i& stack_
 
   VW::reductions::cb_adf* bare = ld.get();
   bool lrp = ld->learn_returns_prediction();
+  // Consecutive models of this reduction are only adjacent in the cs_ldf learner when each owns a single weight.
+  auto* multipredict_ptr = problem_multiplier == 1 ? ::multipredict : nullptr;
   auto* l = make_reduction_learner(std::move(ld), base, learn, predict, stack_builder.get_setupfn_name(cb_adf_setup))
                 .set_input_label_type(VW::label_type_t::CB)
                 .set_output_label_type(VW::label_type_t::CS)
@@ -478,6 +495,7 @@ VW::LEARNER::base_learner* VW::reductions::cb_adf_setup(VW::setup_base_i& stack_
                 .set_output_example_prediction(::output_example_prediction_cb_adf)
                 .set_print_update(::print_update_cb_adf)
                 .set_update_stats(::update_stats_cb_adf)
+                .set_multipredict(multipredict_ptr)
                 .build();
 
   bare->set_scorer(VW::LEARNER::as_singleline(base->get_learner_by_name_prefix("scorer")));
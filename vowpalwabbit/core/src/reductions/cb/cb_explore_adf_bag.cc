@@ -54,6 +54,7 @@ private:
   VW::v_array<VW::action_score> _action_probs;
   std::vector<float> _scores;
   std::vector<float> _top_actions;
+  std::vector<VW::polyprediction> _policy_preds;
   uint32_t get_bag_learner_update_count(uint32_t learner_index);
 };
 
@@ -89,19 +90,22 @@ void cb_explore_adf_bag::predict(VW::LEARNER::multi_learner& base, VW::multi_ex&
   _scores.assign(num_actions, 0.f);
   _top_actions.assign(num_actions, 0);
 
+  // Score all policies in one call so that learners supporting multipredict walk the features only once
+  _policy_preds.resize(_bag_size);
+  VW::LEARNER::multiline_multipredict(base, examples, examples[0]->ft_offset, 0, _bag_size, _policy_preds.data());
+
   for (uint32_t i = 0; i < _bag_size; i++)
   {
-    VW::LEARNER::multiline_learn_or_predict<false>(base, examples, examples[0]->ft_offset, i);
-
-    assert(preds.size() == num_actions);
-    for (auto e : preds) { _scores[e.action] += e.score; }
+    auto& policy_preds = _policy_preds[i].a_s;
+    assert(policy_preds.size() == num_actions);
+    for (auto e : policy_preds) { _scores[e.action] += e.score; }
 
     if (!_first_only)
     {
-      size_t tied_actions = fill_tied(preds);
-      for (size_t j = 0; j < tied_actions; ++j) { _top_actions[preds[j].action] += 1.f / tied_actions; }
+      size_t tied_actions = fill_tied(policy_preds);
+      for (size_t j = 0; j < tied_actions; ++j) { _top_actions[policy_preds[j].action] += 1.f / tied_actions; }
     }
-    else { _top_actions[preds[0].action] += 1.f; }
+    else { _top_actions[policy_preds[0].action] += 1.f; }
   }
 
   _action_probs.clear();
@@ -113,7 +117,8 @@ void cb_explore_adf_bag::predict(VW::LEARNER::multi_learner& base, VW::multi_ex&
 
   VW::explore::enforce_minimum_probability(_epsilon, true, begin_scores(_action_probs), end_scores(_action_probs));
   sort_action_probs(_action_probs, _scores);
-  std::copy(std::begin(_action_probs), std::end(_action_probs), std::begin(preds));
+  preds.clear();
+  for (const auto& action_prob : _action_probs) { preds.push_back(action_prob); }
 }
 
 void cb_explore_adf_bag::learn(VW::LEARNER::multi_learner& base, VW::multi_ex& examples)
@@ -67,6 +67,7 @@ private:
   VW::cs_label _cs_labels_2;
   std::vector<VW::cs_label> _prepped_cs_labels;
   std::vector<VW::cb_label> _cb_labels;
+  std::vector<VW::polyprediction> _policy_preds;
   template <bool is_learn>
   void predict_or_learn_impl(VW::LEARNER::multi_learner& base, VW::multi_ex& examples);
 };
@@ -148,6 +149,14 @@ void cb_explore_adf_cover::predict_or_learn_impl(VW::LEARNER::multi_learner& bas
   }
   else { _action_probs[preds[0].action].score += additive_probability; }
 
+  // When predicting, the remaining policies do not depend on each other and are scored in one call
+  if (!is_learn && _cover_size > 1)
+  {
+    _policy_preds.resize(_cover_size - 1);
+    VW::details::cs_ldf_multipredict(*_cs_ldf_learner, examples, _cb_labels, _cs_labels, _prepped_cs_labels,
+        examples[0]->ft_offset, 2, _cover_size - 1, _policy_preds.data());
+  }
+
   float norm = min_prob * num_actions + (additive_probability - min_prob);
   for (size_t i = 1; i < _cover_size; i++)
   {
@@ -170,30 +179,26 @@ void cb_explore_adf_cover::predict_or_learn_impl(VW::LEARNER::multi_learner& bas
       VW::details::cs_ldf_learn_or_predict<true>(*(_cs_ldf_learner), examples, _cb_labels, _cs_labels_2,
           _prepped_cs_labels, true, examples[0]->ft_offset, i + 1);
     }
-    else
-    {
-      VW::details::cs_ldf_learn_or_predict<false>(*(_cs_ldf_learner), examples, _cb_labels, _cs_labels,
-          _prepped_cs_labels, false, examples[0]->ft_offset, i + 1);
-    }
 
-    for (uint32_t j = 0; j < num_actions; j++) { _scores[j] += preds[j].score; }
+    const auto& policy_preds = is_learn ? preds : _policy_preds[i - 1].a_s;
+    for (uint32_t j = 0; j < num_actions; j++) { _scores[j] += policy_preds[j].score; }
     if (!_first_only)
     {
-      size_t tied_actions = fill_tied(preds);
+      size_t tied_actions = fill_tied(policy_preds);
       const float add_prob = additive_probability / tied_actions;
       for (size_t j = 0; j < tied_actions; ++j)
       {
-        if (_action_probs[preds[j].action].score < min_prob)
+        if (_action_probs[policy_preds[j].action].score < min_prob)
         {
-          norm += (std::max)(0.f, add_prob - (min_prob - _action_probs[preds[j].action].score));
+          norm += (std::max)(0.f, add_prob - (min_prob - _action_probs[policy_preds[j].action].score));
         }
         else { norm += add_prob; }
-        _action_probs[preds[j].action].score += add_prob;
+        _action_probs[policy_preds[j].action].score += add_prob;
       }
     }
     else
     {
-      uint32_t action = preds[0].action;
+      uint32_t action = policy_preds[0].action;
       if (_action_probs[action].score < min_prob)
       {
         norm += (std::max)(0.f, additive_probability - (min_prob - _action_probs[action].score));
@@ -207,7 +212,8 @@ void cb_explore_adf_cover::predict_or_learn_impl(VW::LEARNER::multi_learner& bas
       min_prob * num_actions, !_nounif, begin_scores(_action_probs), end_scores(_action_probs));
 
   sort_action_probs(_action_probs, _scores);
-  for (size_t i = 0; i < num_actions; i++) { preds[i] = _action_probs[i]; }
+  preds.clear();
+  for (const auto& action_prob : _action_probs) { preds.push_back(action_prob); }
 
   if (VW_DEBUG_LOG)
   {
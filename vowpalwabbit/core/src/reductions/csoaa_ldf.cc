@@ -52,6 +52,7 @@ public:
   uint64_t ft_offset = 0;
 
   std::vector<VW::action_scores> stored_preds;
+  std::vector<VW::polyprediction> policy_preds;
 };
 
 inline bool cmp_wclass_ptr(const VW::cs_class* a, const VW::cs_class* b) { return a->x < b->x; }
@@ -135,6 +136,31 @@ void make_single_prediction(ldf& data, single_learner& base, VW::example& ec)
   base.predict(ec);  // make a prediction
 }
 
+// Same as make_single_prediction, but scores the example against `count` consecutive models in one feature walk.
+void make_single_multiprediction(
+    ldf& data, single_learner& base, VW::example& ec, size_t count, VW::polyprediction* pred)
+{
+  uint64_t old_offset = ec.ft_offset;
+
+  VW::details::append_example_namespace_from_memory(data.label_features, ec, ec.l.cs.costs[0].class_index);
+
+  auto restore_guard = VW::scope_exit(
+      [&data, old_offset, &ec, count, pred]
+      {
+        ec.ft_offset = old_offset;
+        // Leave the score of the last model behind, as a sequence of predict calls would.
+        ec.partial_prediction = pred[count - 1].scalar;
+        ec.l.cs.costs[0].partial_prediction = ec.partial_prediction;
+        VW::details::truncate_example_namespace_from_memory(data.label_features, ec, ec.l.cs.costs[0].class_index);
+      });
+
+  ec.l.simple = VW::simple_label{FLT_MAX};
+  ec.ex_reduction_features.template get<VW::simple_label_reduction_features>().reset_to_default();
+
+  ec.ft_offset = data.ft_offset;
+  base.multipredict(ec, 0, count, pred, false);
+}
+
 bool test_ldf_sequence(const VW::multi_ex& ec_seq, VW::io::logger& logger)
 {
   bool is_test;
@@ -168,12 +194,16 @@ void do_actual_learning_wap(ldf& data, single_learner& base, VW::multi_ex& ec_se
     VW::example* ec1 = ec_seq[k1];
 
     // save original variables
-    VW::cs_label save_cs_label = ec1->l.cs;
+    VW::cs_label save_cs_label = std::move(ec1->l.cs);
     auto& simple_lbl = ec1->l.simple;
     auto& simple_red_features = ec1->ex_reduction_features.template get<VW::simple_label_reduction_features>();
 
-    auto costs1 = save_cs_label.costs;
-    if (costs1[0].class_index == static_cast<uint32_t>(-1)) { continue; }
+    const auto& costs1 = save_cs_label.costs;
+    if (costs1[0].class_index == static_cast<uint32_t>(-1))
+    {
+      ec1->l.cs = std::move(save_cs_label);
+      continue;
+    }
 
     VW::details::append_example_namespace_from_memory(data.label_features, *ec1, costs1[0].class_index);
 
@@ -184,13 +214,13 @@ void do_actual_learning_wap(ldf& data, single_learner& base, VW::multi_ex& ec_se
           VW::details::truncate_example_namespace_from_memory(data.label_features, *ec1, costs1[0].class_index);
 
           // restore original cost-sensitive label, sum of importance weights
-          ec1->l.cs = save_cs_label;
+          ec1->l.cs = std::move(save_cs_label);
         });
 
     for (size_t k2 = k1 + 1; k2 < num_classes; k2++)
     {
       VW::example* ec2 = ec_seq[k2];
-      auto costs2 = ec2->l.cs.costs;
+      const auto& costs2 = ec2->l.cs.costs;
 
       if (costs2[0].class_index == static_cast<uint32_t>(-1)) { continue; }
       float value_diff = std::fabs(costs2[0].wap_value - costs1[0].wap_value);
@@ -429,6 +459,31 @@ void predict_csoaa_ldf_rank(ldf& data, single_learner& base, VW::multi_ex& ec_se
   }
 }
 
+// Ranks the actions for `count` consecutive models. pred[c].a_s receives the ranking of model c and
+// ec_seq[0]->pred.a_s is left holding the ranking of the last model.
+void multipredict_csoaa_ldf_rank(ldf& data, single_learner& base, VW::multi_ex& ec_seq_all, size_t count,
+    size_t /* step */, VW::polyprediction* pred, bool /* finalize_predictions */)
+{
+  if (ec_seq_all.empty() || count == 0) { return; }
+  data.ft_offset = ec_seq_all[0]->ft_offset;
+
+  if (data.policy_preds.size() < count) { data.policy_preds.resize(count); }
+  for (size_t c = 0; c < count; c++) { pred[c].a_s.clear(); }
+
+  for (auto* ec : ec_seq_all)
+  {
+    make_single_multiprediction(data, base, *ec, count, data.policy_preds.data());
+    const uint32_t action = ec->l.cs.costs[0].class_index;
+    for (size_t c = 0; c < count; c++) { pred[c].a_s.push_back({action, data.policy_preds[c].scalar}); }
+  }
+
+  for (size_t c = 0; c < count; c++) { std::sort(pred[c].a_s.begin(), pred[c].a_s.end()); }
+
+  auto& last_preds = ec_seq_all[0]->pred.a_s;
+  last_preds.clear();
+  for (const auto& s : pred[count - 1].a_s) { last_preds.push_back(s); }
+}
+
 void csoaa_ldf_multiclass_printline(
     VW::workspace& all, VW::io::writer* output, const VW::multi_ex& ec_seq, VW::io::logger& logger)
 {
@@ -764,11 +819,18 @@ base_learner* VW::reductions::csldf_setup(VW::setup_base_i& stack_builder)
   std::string name_addition;
   VW::prediction_type_t pred_type;
   void (*pred_ptr)(ldf&, single_learner&, VW::multi_ex&);
+  void (*multipredict_ptr)(
+      ldf&, single_learner&, VW::multi_ex&, size_t, size_t, VW::polyprediction*, bool) = nullptr;
   if (ld->rank)
   {
     name_addition = "-rank";
     pred_type = VW::prediction_type_t::ACTION_SCORES;
     pred_ptr = predict_csoaa_ldf_rank;
+    // Ranking uses the unlinked scores, which the scorer's multipredict only reports under the identity link.
+    if (!options.was_supplied("link") || options.get_typed_option<std::string>("link").value() == "identity")
+    {
+      multipredict_ptr = multipredict_csoaa_ldf_rank;
+    }
     update_stats_func = update_stats_csoaa_ldf_rank;
     output_example_prediction_func = output_example_prediction_csoaa_ldf_rank;
     print_update_func = print_update_csoaa_ldf_rank;
@@ -801,6 +863,7 @@ base_learner* VW::reductions::csldf_setup(VW::setup_base_i& stack_builder)
                 .set_update_stats(update_stats_func)
                 .set_output_example_prediction(output_example_prediction_func)
                 .set_print_update(print_update_func)
+                .set_multipredict(multipredict_ptr)
                 .build();
 
   all.example_parser->lbl_parser = VW::cs_label_parser_global;
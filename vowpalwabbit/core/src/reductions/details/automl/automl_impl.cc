@@ -407,7 +407,8 @@ void automl<CMType>::offset_learn(
         for (example* ex : ec) { ex->interactions = incoming_interactions; }
       });
 
-  // Learn and update estimators of challengers
+  // Learn and update estimators of challengers. Slots run one after another: each base.learn goes through the
+  // same learner instances and writes the shared multi_ex, so they cannot be spread across threads.
   for (int64_t current_slot_index = 1; static_cast<size_t>(current_slot_index) < cm->estimators.size();
        ++current_slot_index)
   {
@@ -0,0 +1,128 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#ifdef BUILD_LDA_WITH_SIMD
+
+#  include "expdigammify_simd.h"
+
+#  include <x86intrin.h>
+
+namespace VW
+{
+namespace reductions
+{
+namespace lda
+{
+namespace
+{
+// These are the 8-lane equivalents of the SSE approximations in lda_core.cc.
+
+inline __m256 v8sfl(float x) { return _mm256_set1_ps(x); }
+
+// Lanes [0, remaining) are enabled, used to handle the tail without a scalar loop.
+inline __m256i tail_mask(size_t remaining)
+{
+  const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  return _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(remaining)), lanes);
+}
+
+inline __m256 vfastpow2(const __m256 p)
+{
+  const __m256 offset = _mm256_and_ps(_mm256_cmp_ps(p, v8sfl(0.0f), _CMP_LT_OQ), v8sfl(1.0f));
+  const __m256 clipp = _mm256_max_ps(p, v8sfl(-126.0f));
+  const __m256 z = clipp - _mm256_cvtepi32_ps(_mm256_cvttps_epi32(clipp)) + offset;
+
+  const __m256 v = v8sfl(1 << 23) *
+      (clipp + v8sfl(121.2740838f) + v8sfl(27.7280233f) / (v8sfl(4.84252568f) - z) - v8sfl(1.49012907f) * z);
+
+  return _mm256_castsi256_ps(_mm256_cvttps_epi32(v));
+}
+
+inline __m256 vfastexp(const __m256 p) { return vfastpow2(v8sfl(1.442695040f) * p); }
+
+inline __m256 vfastlog2(const __m256 x)
+{
+  const __m256i vx_i = _mm256_castps_si256(x);
+  const __m256 mx_f = _mm256_castsi256_ps(
+      _mm256_or_si256(_mm256_and_si256(vx_i, _mm256_set1_epi32(0x007FFFFF)), _mm256_set1_epi32(0x3f000000)));
+  const __m256 y = _mm256_cvtepi32_ps(vx_i) * v8sfl(1.1920928955078125e-7f);
+
+  return y - v8sfl(124.22551499f) - v8sfl(1.498030302f) * mx_f - v8sfl(1.72587999f) / (v8sfl(0.3520887068f) + mx_f);
+}
+
+inline __m256 vfastdigamma(const __m256 x)
+{
+  const __m256 twopx = v8sfl(2.0f) + x;
+  const __m256 logterm = v8sfl(0.69314718f) * vfastlog2(twopx);
+
+  return (v8sfl(-48.0f) + x * (v8sfl(-157.0f) + x * (v8sfl(-127.0f) - v8sfl(30.0f) * x))) /
+      (v8sfl(12.0f) * x * (v8sfl(1.0f) + x) * twopx * twopx) +
+      logterm;
+}
+
+// https://stackoverflow.com/questions/23189488/horizontal-sum-of-32-bit-floats-in-256-bit-avx-vector
+inline float horizontal_sum(const __m256& x)
+{
+  const __m128 x128 = _mm_add_ps(_mm256_extractf128_ps(x, 1), _mm256_castps256_ps128(x));
+  const __m128 x64 = _mm_add_ps(x128, _mm_movehl_ps(x128, x128));
+  const __m128 x32 = _mm_add_ss(x64, _mm_shuffle_ps(x64, x64, 0x55));
+  return _mm_cvtss_f32(x32);
+}
+}  // namespace
+
+void expdigammify_avx2(float* gamma, size_t num_topics, float threshold)
+{
+  __m256 sums = v8sfl(0.0f);
+  size_t k = 0;
+  for (; k + 8 <= num_topics; k += 8)
+  {
+    const __m256 arg = _mm256_loadu_ps(gamma + k);
+    sums = sums + arg;
+    _mm256_storeu_ps(gamma + k, vfastdigamma(arg));
+  }
+  const __m256i mask = tail_mask(num_topics - k);
+  if (k < num_topics)
+  {
+    // Disabled lanes load as zero, so they do not contribute to the sum.
+    const __m256 arg = _mm256_maskload_ps(gamma + k, mask);
+    sums = sums + arg;
+    _mm256_maskstore_ps(gamma + k, mask, vfastdigamma(arg));
+  }
+
+  const __m256 digamma_sum = vfastdigamma(v8sfl(horizontal_sum(sums)));
+  const __m256 thresholds = v8sfl(threshold);
+  for (k = 0; k + 8 <= num_topics; k += 8)
+  {
+    const __m256 arg = _mm256_loadu_ps(gamma + k);
+    _mm256_storeu_ps(gamma + k, _mm256_max_ps(thresholds, vfastexp(arg - digamma_sum)));
+  }
+  if (k < num_topics)
+  {
+    const __m256 arg = _mm256_maskload_ps(gamma + k, mask);
+    _mm256_maskstore_ps(gamma + k, mask, _mm256_max_ps(thresholds, vfastexp(arg - digamma_sum)));
+  }
+}
+
+void expdigammify_2_avx2(float* gamma, const float* norm, size_t num_topics, float threshold)
+{
+  const __m256 thresholds = v8sfl(threshold);
+  size_t k = 0;
+  for (; k + 8 <= num_topics; k += 8)
+  {
+    const __m256 arg = vfastdigamma(_mm256_loadu_ps(gamma + k)) - _mm256_loadu_ps(norm + k);
+    _mm256_storeu_ps(gamma + k, _mm256_max_ps(thresholds, vfastexp(arg)));
+  }
+  if (k < num_topics)
+  {
+    const __m256i mask = tail_mask(num_topics - k);
+    const __m256 arg = vfastdigamma(_mm256_maskload_ps(gamma + k, mask)) - _mm256_maskload_ps(norm + k, mask);
+    _mm256_maskstore_ps(gamma + k, mask, _mm256_max_ps(thresholds, vfastexp(arg)));
+  }
+}
+
+}  // namespace lda
+}  // namespace reductions
+}  // namespace VW
+
+#endif
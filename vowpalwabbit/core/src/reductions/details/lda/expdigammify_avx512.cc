@@ -0,0 +1,116 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#ifdef BUILD_LDA_WITH_SIMD
+
+#  include "expdigammify_simd.h"
+
+#  include <x86intrin.h>
+
+namespace VW
+{
+namespace reductions
+{
+namespace lda
+{
+namespace
+{
+// These are the 16-lane equivalents of the SSE approximations in lda_core.cc.
+
+inline __m512 v16sfl(float x) { return _mm512_set1_ps(x); }
+
+// Lanes [0, remaining) are enabled, used to handle the tail without a scalar loop.
+inline __mmask16 tail_mask(size_t remaining) { return static_cast<__mmask16>((1u << remaining) - 1u); }
+
+inline __m512 vfastpow2(const __m512 p)
+{
+  const __m512 offset = _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(p, v16sfl(0.0f), _CMP_LT_OQ), v16sfl(1.0f));
+  const __m512 clipp = _mm512_max_ps(p, v16sfl(-126.0f));
+  const __m512 z = clipp - _mm512_cvtepi32_ps(_mm512_cvttps_epi32(clipp)) + offset;
+
+  const __m512 v = v16sfl(1 << 23) *
+      (clipp + v16sfl(121.2740838f) + v16sfl(27.7280233f) / (v16sfl(4.84252568f) - z) - v16sfl(1.49012907f) * z);
+
+  return _mm512_castsi512_ps(_mm512_cvttps_epi32(v));
+}
+
+inline __m512 vfastexp(const __m512 p) { return vfastpow2(v16sfl(1.442695040f) * p); }
+
+inline __m512 vfastlog2(const __m512 x)
+{
+  const __m512i vx_i = _mm512_castps_si512(x);
+  const __m512 mx_f = _mm512_castsi512_ps(
+      _mm512_or_si512(_mm512_and_si512(vx_i, _mm512_set1_epi32(0x007FFFFF)), _mm512_set1_epi32(0x3f000000)));
+  const __m512 y = _mm512_cvtepi32_ps(vx_i) * v16sfl(1.1920928955078125e-7f);
+
+  return y - v16sfl(124.22551499f) - v16sfl(1.498030302f) * mx_f -
+      v16sfl(1.72587999f) / (v16sfl(0.3520887068f) + mx_f);
+}
+
+inline __m512 vfastdigamma(const __m512 x)
+{
+  const __m512 twopx = v16sfl(2.0f) + x;
+  const __m512 logterm = v16sfl(0.69314718f) * vfastlog2(twopx);
+
+  return (v16sfl(-48.0f) + x * (v16sfl(-157.0f) + x * (v16sfl(-127.0f) - v16sfl(30.0f) * x))) /
+      (v16sfl(12.0f) * x * (v16sfl(1.0f) + x) * twopx * twopx) +
+      logterm;
+}
+}  // namespace
+
+void expdigammify_avx512(float* gamma, size_t num_topics, float threshold)
+{
+  __m512 sums = v16sfl(0.0f);
+  size_t k = 0;
+  for (; k + 16 <= num_topics; k += 16)
+  {
+    const __m512 arg = _mm512_loadu_ps(gamma + k);
+    sums = sums + arg;
+    _mm512_storeu_ps(gamma + k, vfastdigamma(arg));
+  }
+  const __mmask16 mask = tail_mask(num_topics - k);
+  if (k < num_topics)
+  {
+    // Disabled lanes load as zero, so they do not contribute to the sum.
+    const __m512 arg = _mm512_maskz_loadu_ps(mask, gamma + k);
+    sums = sums + arg;
+    _mm512_mask_storeu_ps(gamma + k, mask, vfastdigamma(arg));
+  }
+
+  const __m512 digamma_sum = vfastdigamma(v16sfl(_mm512_reduce_add_ps(sums)));
+  const __m512 thresholds = v16sfl(threshold);
+  for (k = 0; k + 16 <= num_topics; k += 16)
+  {
+    const __m512 arg = _mm512_loadu_ps(gamma + k);
+    _mm512_storeu_ps(gamma + k, _mm512_max_ps(thresholds, vfastexp(arg - digamma_sum)));
+  }
+  if (k < num_topics)
+  {
+    const __m512 arg = _mm512_maskz_loadu_ps(mask, gamma + k);
+    _mm512_mask_storeu_ps(gamma + k, mask, _mm512_max_ps(thresholds, vfastexp(arg - digamma_sum)));
+  }
+}
+
+void expdigammify_2_avx512(float* gamma, const float* norm, size_t num_topics, float threshold)
+{
+  const __m512 thresholds = v16sfl(threshold);
+  size_t k = 0;
+  for (; k + 16 <= num_topics; k += 16)
+  {
+    const __m512 arg = vfastdigamma(_mm512_loadu_ps(gamma + k)) - _mm512_loadu_ps(norm + k);
+    _mm512_storeu_ps(gamma + k, _mm512_max_ps(thresholds, vfastexp(arg)));
+  }
+  if (k < num_topics)
+  {
+    const __mmask16 mask = tail_mask(num_topics - k);
+    const __m512 arg = vfastdigamma(_mm512_maskz_loadu_ps(mask, gamma + k)) - _mm512_maskz_loadu_ps(mask, norm + k);
+    _mm512_mask_storeu_ps(gamma + k, mask, _mm512_max_ps(thresholds, vfastexp(arg)));
+  }
+}
+
+}  // namespace lda
+}  // namespace reductions
+}  // namespace VW
+
+#endif
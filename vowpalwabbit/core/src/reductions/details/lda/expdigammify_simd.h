@@ -0,0 +1,39 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+// TODO: Make simd work with MSVC. Only works on linux for now.
+// TODO: Only works for x86. Make simd work on other architectures e.g. using SIMDe.
+#ifdef BUILD_LDA_WITH_SIMD
+
+#  include <cstddef>
+
+namespace VW
+{
+namespace reductions
+{
+namespace lda
+{
+inline bool cpu_supports_avx2() { return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"); }
+
+inline bool cpu_supports_avx512() { return __builtin_cpu_supports("avx512f"); }
+
+// gamma[k] = max(threshold, exp(digamma(gamma[k]) - digamma(sum(gamma)))), 8 topics at a time.
+void expdigammify_avx2(float* gamma, size_t num_topics, float threshold);
+
+// gamma[k] = max(threshold, exp(digamma(gamma[k]) - norm[k])), 8 topics at a time.
+void expdigammify_2_avx2(float* gamma, const float* norm, size_t num_topics, float threshold);
+
+// gamma[k] = max(threshold, exp(digamma(gamma[k]) - digamma(sum(gamma)))), 16 topics at a time.
+void expdigammify_avx512(float* gamma, size_t num_topics, float threshold);
+
+// gamma[k] = max(threshold, exp(digamma(gamma[k]) - norm[k])), 16 topics at a time.
+void expdigammify_2_avx512(float* gamma, const float* norm, size_t num_topics, float threshold);
+
+}  // namespace lda
+}  // namespace reductions
+}  // namespace VW
+
+#endif
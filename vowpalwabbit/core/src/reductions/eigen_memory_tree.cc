@@ -23,6 +23,7 @@
 #include "vw/io/logger.h"
 
 #include <algorithm>
+#include <array>
 #include <cfloat>
 #include <climits>
 #include <cmath>
@@ -203,45 +204,126 @@ void emt_abs(emt_feats& fs)
   for (auto& f : fs) { f.second = std::abs(f.second); }
 }
 
-emt_feats emt_scale_add(float s1, const emt_feats& f1, float s2, const emt_feats& f2)
+// Walks the union of the sorted indices of f1 and f2 in order, calling func(index, f1 value, f2 value) with 0 for a
+// value that is missing on one side.
+template <typename FuncT>
+inline void emt_merge(const emt_feats& f1, const emt_feats& f2, FuncT&& func)
 {
   size_t idx1 = 0;
   size_t idx2 = 0;
 
-  uint64_t index = 0;
-  uint64_t f1_idx = 0;
-  uint64_t f2_idx = 0;
+  while (idx1 < f1.size() && idx2 < f2.size())
+  {
+    const auto& x = f1[idx1];
+    const auto& y = f2[idx2];
+
+    if (x.first < y.first)
+    {
+      func(x.first, x.second, 0.f);
+      idx1++;
+    }
+    else if (y.first < x.first)
+    {
+      func(y.first, 0.f, y.second);
+      idx2++;
+    }
+    else
+    {
+      func(x.first, x.second, y.second);
+      idx1++;
+      idx2++;
+    }
+  }
+
+  for (; idx1 < f1.size(); idx1++) { func(f1[idx1].first, f1[idx1].second, 0.f); }
+  for (; idx2 < f2.size(); idx2++) { func(f2[idx2].first, 0.f, f2[idx2].second); }
+}
 
-  float f1_val = 0.f;
-  float f2_val = 0.f;
+void emt_scale_add(float s1, const emt_feats& f1, float s2, const emt_feats& f2, emt_feats& out)
+{
+  out.clear();
+  out.reserve(f1.size() + f2.size());
+  emt_merge(f1, f2, [&out, s1, s2](uint64_t index, float v1, float v2) { out.emplace_back(index, v1 * s1 + v2 * s2); });
+}
 
+emt_feats emt_scale_add(float s1, const emt_feats& f1, float s2, const emt_feats& f2)
+{
   emt_feats out;
+  emt_scale_add(s1, f1, s2, f2, out);
+  return out;
+}
 
-  while (idx1 < f1.size() || idx2 < f2.size())
-  {
-    f1_idx = (idx1 == f1.size()) ? INT_MAX : f1[idx1].first;
-    f2_idx = (idx2 == f2.size()) ? INT_MAX : f2[idx2].first;
+float emt_distance(const emt_feats& xs, const emt_feats& ys)
+{
+  float sum_diff_sq = 0;
+  emt_merge(xs, ys,
+      [&sum_diff_sq](uint64_t, float x, float y)
+      {
+        const float diff = x - y;
+        sum_diff_sq += diff * diff;
+      });
+  return std::sqrt(sum_diff_sq);
+}
 
-    f1_val = 0.f;
-    f2_val = 0.f;
+void emt_leaf_distances(const emt_feats& query, const std::vector<std::unique_ptr<emt_example>>& memories,
+    std::vector<float>& dense_query, std::vector<float>& distances)
+{
+  distances.clear();
+  const uint64_t query_end = query.empty() ? 0 : query.back().first + 1;
+  if (dense_query.size() < query_end) { dense_query.resize(query_end, 0.f); }
+
+  // The squared query terms are summed in double, where the product of two floats is exact, so that the difference
+  // below cancels to zero for a memory holding every query feature.
+  double query_sq = 0;
+  for (const auto& q : query)
+  {
+    dense_query[q.first] = q.second;
+    query_sq += static_cast<double>(q.second) * q.second;
+  }
 
-    if (f1_idx <= f2_idx)
+  const float* dense = dense_query.data();
+  for (const auto& memory : memories)
+  {
+    const auto& m = memory->full;
+    // Memory features past the last query index have nothing to gather against.
+    const auto split = std::lower_bound(m.begin(), m.end(), query_end,
+                           [](const std::pair<uint64_t, float>& f, uint64_t index) { return f.first < index; }) -
+        m.begin();
+    const size_t shared_end = static_cast<size_t>(split);
+
+    // Four independent accumulators keep the loop free of a serial dependency so that it can be vectorized.
+    std::array<float, 4> diff_sq{};
+    std::array<double, 4> gathered_sq{};
+    size_t k = 0;
+    for (; k + 4 <= shared_end; k += 4)
     {
-      index = f1_idx;
-      f1_val = f1[idx1].second;
-      idx1++;
+      for (size_t lane = 0; lane < 4; ++lane)
+      {
+        const float q = dense[m[k + lane].first];
+        const float diff = m[k + lane].second - q;
+        diff_sq[lane] += diff * diff;
+        gathered_sq[lane] += static_cast<double>(q) * q;
+      }
     }
-
-    if (f2_idx <= f1_idx)
+    for (; k < shared_end; ++k)
     {
-      index = f2_idx;
-      f2_val = f2[idx2].second;
-      idx2++;
+      const float q = dense[m[k].first];
+      const float diff = m[k].second - q;
+      diff_sq[0] += diff * diff;
+      gathered_sq[0] += static_cast<double>(q) * q;
     }
 
-    out.emplace_back(index, f1_val * s1 + f2_val * s2);
+    float tail_sq = 0;
+    for (; k < m.size(); ++k) { tail_sq += m[k].second * m[k].second; }
+
+    // The query features the memory does not have are the ones the gather did not reach.
+    const double gathered = (gathered_sq[0] + gathered_sq[1]) + (gathered_sq[2] + gathered_sq[3]);
+    const auto unmatched_sq = static_cast<float>(std::max(query_sq - gathered, 0.0));
+    const float sum_sq = (diff_sq[0] + diff_sq[1]) + (diff_sq[2] + diff_sq[3]) + tail_sq + unmatched_sq;
+    distances.push_back(std::sqrt(sum_sq));
   }
-  return out;
+
+  for (const auto& q : query) { dense_query[q.first] = 0.f; }
 }
 
 emt_feats emt_router_random(std::vector<emt_feats>& exs, VW::rand_state& rng)
@@ -268,19 +350,28 @@ emt_feats emt_router_eigen(std::vector<emt_feats>& exs, VW::rand_state& rng)
 
   auto weights = emt_router_random(exs, rng);
 
-  std::map<int, float> sums;
-  emt_feats means;
+  // Sum per index by sorting all features by index. The sort is stable so each index is still summed in example
+  // order.
+  emt_feats all_feats;
+  for (auto& ex : exs) { all_feats.insert(all_feats.end(), ex.begin(), ex.end()); }
+  std::stable_sort(all_feats.begin(), all_feats.end(),
+      [](const std::pair<uint64_t, float>& a, const std::pair<uint64_t, float>& b) { return a.first < b.first; });
 
-  for (auto& ex : exs)
+  emt_feats means;
+  for (size_t i = 0; i < all_feats.size();)
   {
-    for (auto& p : ex) { sums[p.first] += p.second; }
+    const uint64_t index = all_feats[i].first;
+    float sum = 0;
+    for (; i < all_feats.size() && all_feats[i].first == index; i++) { sum += all_feats[i].second; }
+    means.emplace_back(index, sum / exs.size());
   }
-  for (auto& p : sums) { means.emplace_back(p.first, p.second / exs.size()); }
 
   std::vector<emt_feats> centered_exs;
   centered_exs.reserve(exs.size());
   for (auto& e : exs) { centered_exs.push_back(emt_scale_add(1, e, -1, means)); }
 
+  emt_feats next_weights;
+
   int n_epochs = 40;  // the bigger the better eigen approximation
 
   for (int i = 0; i < n_epochs; i++)
@@ -298,7 +389,8 @@ emt_feats emt_router_eigen(std::vector<emt_feats>& exs, VW::rand_state& rng)
       // weights = weights + (1/n) * inner(outer(fs,fs), weights)
       //         = weights + (1/n) * fs * inner(fs,weights)
       //         =          weights+(1/n)*inner(fs,weights)*fs
-      weights = emt_scale_add(1, weights, (1 / n) * emt_inner(fs, weights), fs);
+      emt_scale_add(1, weights, (1 / n) * emt_inner(fs, weights), fs, next_weights);
+      std::swap(weights, next_weights);
       emt_normalize(weights);
       n += 1;
     }
@@ -365,6 +457,18 @@ void scorer_features(const emt_feats& f1, VW::features& out)
   }
 }
 
+// Writes |f1 - f2| into out, skipping zeros, directly from a merge of the two memories.
+void scorer_abs_diff_features(const emt_feats& f1, const emt_feats& f2, VW::features& out)
+{
+  out.clear();
+  emt_merge(f1, f2,
+      [&out](uint64_t index, float v1, float v2)
+      {
+        const float diff = std::abs(v1 - v2);
+        if (diff != 0) { out.push_back(diff, index); }
+      });
+}
+
 void scorer_example(emt_tree& b, const emt_example& ex1, const emt_example& ex2)
 {
   VW::example& out = *b.ex;
@@ -382,9 +486,7 @@ void scorer_example(emt_tree& b, const emt_example& ex1, const emt_example& ex2)
     out.feature_space[X_NS].clear();
     out.feature_space[Z_NS].clear();
 
-    emt_feats feat_diff = emt_scale_add(1, ex1.full, -1, ex2.full);
-    emt_abs(feat_diff);
-    scorer_features(feat_diff, out.feature_space[X_NS]);
+    scorer_abs_diff_features(ex1.full, ex2.full, out.feature_space[X_NS]);
 
     out.total_sum_feat_sq = out.feature_space[X_NS].sum_feat_sq;
     out.num_features = out.feature_space[X_NS].size();
@@ -418,7 +520,7 @@ void scorer_example(emt_tree& b, const emt_example& ex1, const emt_example& ex2)
     out.total_sum_feat_sq = out.feature_space[X_NS].sum_feat_sq + out.feature_space[Z_NS].sum_feat_sq;
     out.num_features = out.feature_space[X_NS].size() + out.feature_space[Z_NS].size();
 
-    auto initial = scorer_initial(emt_norm(emt_scale_add(1, ex1.full, -1, ex2.full)));
+    auto initial = scorer_initial(emt_distance(ex1.full, ex2.full));
     out.ex_reduction_features.get<VW::simple_label_reduction_features>().initial = initial;
   }
 
@@ -450,7 +552,7 @@ float scorer_predict(emt_tree& b, single_learner& base, const emt_example& pred_
 
   if (b.scorer_type == emt_scorer_type::DISTANCE)  // dist scorer
   {
-    return emt_norm(emt_scale_add(1, pred_ex.full, -1, leaf_ex.full));
+    return emt_distance(pred_ex.full, leaf_ex.full);
   }
 
   // The features matched exactly. Return max negative to make sure it is picked.
@@ -598,9 +700,14 @@ emt_example* node_pick(emt_tree& b, single_learner& base, emt_node& cn, const em
   // shuffle the examples to break ties randomly
   emt_shuffle(cn.examples.begin(), cn.examples.end(), *b.random_state);
 
-  for (auto const& example : cn.examples)
+  // The distance scorer does not need the base learner, so the whole leaf is scored in one batch.
+  const bool batched = b.scorer_type == emt_scorer_type::DISTANCE;
+  if (batched) { emt_leaf_distances(ex.full, cn.examples, b.dense_query, b.leaf_scores); }
+
+  for (size_t i = 0; i < cn.examples.size(); ++i)
   {
-    float score = scorer_predict(b, base, ex, *example);
+    const auto& example = cn.examples[i];
+    float score = batched ? b.leaf_scores[i] : scorer_predict(b, base, ex, *example);
 
     if (score < best_score)
     {
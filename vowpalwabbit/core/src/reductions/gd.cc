@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <cfloat>
+#include <thread>
 
 #if !defined(VW_NO_INLINE_SIMD)
 #  if !defined(__SSE2__) && (defined(_M_AMD64) || defined(_M_X64))
@@ -33,6 +34,7 @@
 #include "vw/core/parse_regressor.h"
 #include "vw/core/reductions/gd.h"
 #include "vw/core/shared_data.h"
+#include "vw/core/thread_pool.h"
 #include "vw/core/vw.h"
 #include "vw/core/vw_versions.h"
 
@@ -48,6 +50,53 @@ namespace
 constexpr double L1_STATE_DEFAULT = 0.;
 constexpr double L2_STATE_DEFAULT = 1.;
 
+// Dense merges are split into contiguous ranges of weight indices, one per hardware thread. Every range folds in all
+// sources before moving on, so each output block is written by a single thread while it is still in cache.
+template <typename FuncT>
+void for_each_weight_range(size_t length, const FuncT& func)
+{
+  constexpr size_t MIN_RANGE_LENGTH = 1 << 16;
+  // hardware_concurrency is 0 when unknown and often 1 in containers. Allowing two ranges regardless keeps large merges
+  // split, and the split tested, on every machine.
+  const size_t max_ranges = std::max<size_t>(2, std::thread::hardware_concurrency());
+  const size_t num_ranges = std::max<size_t>(1, std::min<size_t>(max_ranges, length / MIN_RANGE_LENGTH));
+  if (num_ranges == 1)
+  {
+    func(0, length);
+    return;
+  }
+
+  VW::thread_pool pool(num_ranges - 1);
+  std::vector<std::future<void>> futures;
+  futures.reserve(num_ranges - 1);
+  for (size_t r = 1; r < num_ranges; ++r)
+  {
+    futures.emplace_back(pool.submit(
+        [&func, length, num_ranges](size_t range)
+        { func(length * range / num_ranges, length * (range + 1) / num_ranges); },
+        r));
+  }
+  func(0, length / num_ranges);
+  for (auto& f : futures) { f.get(); }
+}
+
+void merge_weights_simple(size_t length, const std::vector<std::reference_wrapper<const VW::dense_parameters>>& source,
+    const std::vector<float>& per_model_weighting, VW::dense_parameters& weights)
+{
+  for_each_weight_range(length,
+      [&](size_t begin, size_t end)
+      {
+        for (size_t i = 0; i < source.size(); i++)
+        {
+          const auto& this_source = source[i].get();
+          for (size_t j = begin; j < end; j++)
+          {
+            weights.strided_index(j) += (this_source.strided_index(j) * per_model_weighting[i]);
+          }
+        }
+      });
+}
+
 template <typename WeightsT>
 void merge_weights_simple(size_t length, const std::vector<std::reference_wrapper<const WeightsT>>& source,
     const std::vector<float>& per_model_weighting, WeightsT& weights)
@@ -68,11 +117,18 @@ void merge_weights_with_save_resume(size_t length,
 {
   // Adaptive totals
   std::vector<float> adaptive_totals(length, 0.f);
-  for (const auto& model : source)
-  {
-    const auto& this_model = model.get();
-    for (size_t i = 0; i < length; i++) { adaptive_totals[i] += (&(this_model[i << weights.stride_shift()]))[1]; }
-  }
+  for_each_weight_range(length,
+      [&](size_t begin, size_t end)
+      {
+        for (const auto& model : source)
+        {
+          const auto& this_model = model.get();
+          for (size_t i = begin; i < end; i++)
+          {
+            adaptive_totals[i] += (&(this_model[i << weights.stride_shift()]))[1];
+          }
+        }
+      });
 
   for (size_t i = 0; i < source.size(); i++)
   {
@@ -80,13 +136,18 @@ void merge_weights_with_save_resume(size_t length,
   }
 
   // Weights have already been reweighted, so just accumulate.
-  for (const auto& model_num : source)
-  {
-    const auto& this_source = model_num.get();
-    // Intentionally add irrespective of stride.
-    const auto full_weights_size = length << weights.stride_shift();
-    for (uint64_t i = 0; i < full_weights_size; i++) { weights[i] += this_source[i]; }
-  }
+  for_each_weight_range(length,
+      [&](size_t begin, size_t end)
+      {
+        // Intentionally add irrespective of stride.
+        const uint64_t full_begin = static_cast<uint64_t>(begin) << weights.stride_shift();
+        const uint64_t full_end = static_cast<uint64_t>(end) << weights.stride_shift();
+        for (const auto& model_num : source)
+        {
+          const auto& this_source = model_num.get();
+          for (uint64_t i = full_begin; i < full_end; i++) { weights[i] += this_source[i]; }
+        }
+      });
 }
 
 template <typename WeightsT>
@@ -16,21 +16,25 @@
 #include "vw/core/numeric_casts.h"
 #include "vw/core/reductions/gd.h"
 #include "vw/core/setup_base.h"
+#include "vw/core/thread_pool.h"
 #include "vw/core/version.h"
 #include "vw/core/vw.h"
 #include "vw/core/vw_allreduce.h"
 #include "vw/core/vw_versions.h"
 #include "vw/io/logger.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cfloat>
 #include <cmath>
 #include <cstdio>
 #include <cstring>
 #include <fstream>
+#include <future>
 #include <map>
 #include <memory>
 #include <sstream>
+#include <vector>
 
 #define SVM_KER_LIN 0
 #define SVM_KER_RBF 1
@@ -45,14 +49,15 @@ namespace
 {
 class svm_params;
 
-static size_t num_kernel_evals = 0;
-static size_t num_cache_evals = 0;
+// Kernel rows shorter than this are computed on the calling thread.
+constexpr size_t MIN_KERNELS_PER_TASK = 64;
 
 class svm_example
 {
 public:
   VW::v_array<float> krow;
   VW::flat_example ex;
+  uint64_t last_used = 0;  // value of svm_params::lru_clock when krow was last read, for cache eviction
 
   ~svm_example();
   void init_svm_example(VW::flat_example* fec);
@@ -106,8 +111,17 @@ public:
   uint64_t reprocess = 0;
 
   svm_model* model = nullptr;
-  size_t maxcache = 0;
-  // size_t curcache;
+  size_t maxcache = 0;  // maximum number of cached kernel values
+  uint64_t lru_clock = 0;
+  std::vector<svm_example*> lru_rows;
+
+  // kernel rows are split across these threads, if any
+  std::unique_ptr<VW::thread_pool> kernel_pool;
+  std::vector<std::future<void>> kernel_futures;
+
+  size_t num_kernel_evals = 0;
+  size_t num_cache_evals = 0;
+  size_t num_threaded_rows = 0;  // kernel rows split across kernel_pool
 
   svm_example** pool = nullptr;
   float lambda = 0.f;
@@ -147,28 +161,51 @@ svm_example::~svm_example()
 }
 
 float kernel_function(const VW::flat_example* fec1, const VW::flat_example* fec2, void* params, size_t kernel_type);
+int trim_cache(svm_params& params, const svm_example* in_use, size_t reserve);
+
+void compute_kernel_range(svm_params& params, svm_example& sec, size_t begin, size_t end)
+{
+  for (size_t i = begin; i < end; i++)
+  {
+    sec.krow[i] =
+        kernel_function(&sec.ex, &(params.model->support_vec[i]->ex), params.kernel_params, params.kernel_type);
+  }
+}
 
 int svm_example::compute_kernels(svm_params& params)
 {
   int alloc = 0;
   svm_model* model = params.model;
   size_t n = model->num_support;
+  last_used = ++params.lru_clock;
 
   if (krow.size() < n)
   {
     // computing new kernel values and caching them
-    // if(params->curcache + n > params->maxcache)
-    // trim_cache(params);
-    num_kernel_evals += krow.size();
-    for (size_t i = krow.size(); i < n; i++)
+    const size_t begin = krow.size();
+    trim_cache(params, this, n - begin);
+    params.num_kernel_evals += n - begin;
+    krow.resize(n);
+    alloc = static_cast<int>(n - begin);
+
+    const size_t num_threads = params.kernel_pool == nullptr ? 0 : params.kernel_pool->size();
+    const size_t num_tasks = std::min(num_threads, (n - begin) / MIN_KERNELS_PER_TASK);
+    if (num_tasks < 2) { compute_kernel_range(params, *this, begin, n); }
+    else
     {
-      svm_example* sec = model->support_vec[i];
-      float kv = kernel_function(&ex, &(sec->ex), params.kernel_params, params.kernel_type);
-      krow.push_back(kv);
-      alloc += 1;
+      params.num_threaded_rows++;
+      params.kernel_futures.clear();
+      for (size_t t = 0; t < num_tasks; t++)
+      {
+        const size_t task_begin = begin + (n - begin) * t / num_tasks;
+        const size_t task_end = begin + (n - begin) * (t + 1) / num_tasks;
+        params.kernel_futures.emplace_back(params.kernel_pool->submit(
+            [&params, this, task_begin, task_end]() { compute_kernel_range(params, *this, task_begin, task_end); }));
+      }
+      for (auto& f : params.kernel_futures) { f.get(); }
     }
   }
-  else { num_cache_evals += n; }
+  else { params.num_cache_evals += n; }
   return alloc;
 }
 
@@ -218,20 +255,41 @@ static int make_hot_sv(svm_params& params, size_t svi)
       e->krow[0] = kv;
     }
   }
+  alloc += trim_cache(params, svi_e, 0);
   return alloc;
 }
 
-static int trim_cache(svm_params& params)
+size_t cached_kernels(const svm_params& params)
+{
+  size_t cached = 0;
+  for (size_t i = 0; i < params.model->num_support; i++) { cached += params.model->support_vec[i]->krow.size(); }
+  return cached;
+}
+
+// Drops whole kernel rows, least recently used first, until reserve more kernel values fit into maxcache. The row of
+// in_use is about to be read and is kept, so the bound only fails when that single row is larger than the cache.
+int trim_cache(svm_params& params, const svm_example* in_use, size_t reserve)
 {
-  int sz = static_cast<int>(params.maxcache);
+  const size_t maxcache = params.maxcache > reserve ? params.maxcache - reserve : 0;
+  size_t cached = cached_kernels(params);
+  if (cached <= maxcache) { return 0; }
+
   svm_model* model = params.model;
-  size_t n = model->num_support;
-  int alloc = 0;
-  for (size_t i = 0; i < n; i++)
+  params.lru_rows.clear();
+  for (size_t i = 0; i < model->num_support; i++)
   {
     svm_example* e = model->support_vec[i];
-    sz -= static_cast<int>(e->krow.size());
-    if (sz < 0) { alloc += e->clear_kernels(); }
+    if (e != in_use && !e->krow.empty()) { params.lru_rows.push_back(e); }
+  }
+  std::sort(params.lru_rows.begin(), params.lru_rows.end(),
+      [](const svm_example* a, const svm_example* b) { return a->last_used < b->last_used; });
+
+  int alloc = 0;
+  for (svm_example* e : params.lru_rows)
+  {
+    if (cached <= maxcache) { break; }
+    cached -= e->krow.size();
+    alloc += e->clear_kernels();
   }
   return alloc;
 }
@@ -682,12 +740,12 @@ void learn(svm_params& params, base_learner&, VW::example& ec)
     ec.pred.scalar = score;
     ec.loss = std::max(0.f, 1.f - score * ec.l.simple.label);
     params.loss_sum += ec.loss;
-    if (params.all->training && ec.example_counter % 100 == 0) { trim_cache(params); }
     if (params.all->training && ec.example_counter % 1000 == 0 && ec.example_counter >= 2)
     {
       *params.all->trace_message << "Number of support vectors = " << params.model->num_support << endl;
-      *params.all->trace_message << "Number of kernel evaluations = " << num_kernel_evals << " "
-                                 << "Number of cache queries = " << num_cache_evals << " loss sum = " << params.loss_sum
+      *params.all->trace_message << "Number of kernel evaluations = " << params.num_kernel_evals << " "
+                                 << "Number of cache queries = " << params.num_cache_evals
+                                 << " loss sum = " << params.loss_sum
                                  << " " << params.model->alpha[params.model->num_support - 1] << " "
                                  << params.model->alpha[params.model->num_support - 2] << endl;
     }
@@ -707,11 +765,20 @@ void finish_kernel_svm(svm_params& params)
   if (params.all != nullptr)
   {
     *(params.all->trace_message) << "Num support = " << params.model->num_support << endl;
-    *(params.all->trace_message) << "Number of kernel evaluations = " << num_kernel_evals << " "
-                                 << "Number of cache queries = " << num_cache_evals << endl;
+    *(params.all->trace_message) << "Number of kernel evaluations = " << params.num_kernel_evals << " "
+                                 << "Number of cache queries = " << params.num_cache_evals << endl;
     *(params.all->trace_message) << "Total loss = " << params.loss_sum << endl;
   }
 }
+
+void persist_metrics(svm_params& params, VW::metric_sink& metrics)
+{
+  metrics.set_uint("ksvm_num_support", params.model->num_support);
+  metrics.set_uint("ksvm_kernel_evals", params.num_kernel_evals);
+  metrics.set_uint("ksvm_cache_queries", params.num_cache_evals);
+  metrics.set_uint("ksvm_cached_kernels", cached_kernels(params));
+  metrics.set_uint("ksvm_threaded_kernel_rows", params.num_threaded_rows);
+}
 }  // namespace
 
 VW::LEARNER::base_learner* VW::reductions::kernel_svm_setup(VW::setup_base_i& stack_builder)
@@ -726,6 +793,8 @@ VW::LEARNER::base_learner* VW::reductions::kernel_svm_setup(VW::setup_base_i& st
   uint64_t pool_size;
   uint64_t reprocess;
   uint64_t subsample;
+  uint64_t cache_size;
+  uint64_t num_threads;
 
   bool ksvm = false;
 
@@ -742,7 +811,13 @@ VW::LEARNER::base_learner* VW::reductions::kernel_svm_setup(VW::setup_base_i& st
                .one_of({"linear", "rbf", "poly"})
                .help("Type of kernel"))
       .add(make_option("bandwidth", bandwidth).keep().default_value(1.f).help("Bandwidth of rbf kernel"))
-      .add(make_option("degree", degree).keep().default_value(2).help("Degree of poly kernel"));
+      .add(make_option("degree", degree).keep().default_value(2).help("Degree of poly kernel"))
+      .add(make_option("ksvm_cache_size", cache_size)
+               .default_value(1024 * 1024 * 1024)
+               .help("Maximum number of cached kernel values. Least recently used kernel rows are evicted first"))
+      .add(make_option("ksvm_threads", num_threads)
+               .default_value(0)
+               .help("Number of threads used to compute kernel rows. 0 computes them on the learner thread"));
 
   if (!options.add_parse_and_check_necessary(new_options)) { return nullptr; }
 
@@ -757,7 +832,8 @@ VW::LEARNER::base_learner* VW::reductions::kernel_svm_setup(VW::setup_base_i& st
   params->model = &VW::details::calloc_or_throw<svm_model>();
   new (params->model) svm_model();
   params->model->num_support = 0;
-  params->maxcache = 1024 * 1024 * 1024;
+  params->maxcache = VW::cast_to_smaller_type<size_t>(cache_size);
+  if (num_threads > 0) { params->kernel_pool = VW::make_unique<VW::thread_pool>(num_threads); }
   params->loss_sum = 0.;
   params->all = &all;
   params->random_state = all.get_random_state();
@@ -803,6 +879,7 @@ VW::LEARNER::base_learner* VW::reductions::kernel_svm_setup(VW::setup_base_i& st
       VW::prediction_type_t::SCALAR, VW::label_type_t::SIMPLE)
                 .set_save_load(save_load)
                 .set_finish(finish_kernel_svm)
+                .set_persist_metrics(persist_metrics)
                 .set_output_example_prediction(VW::details::output_example_prediction_simple_label<svm_params>)
                 .set_update_stats(VW::details::update_stats_simple_label<svm_params>)
                 .set_print_update(VW::details::print_update_simple_label<svm_params>)
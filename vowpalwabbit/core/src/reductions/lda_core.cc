@@ -4,6 +4,7 @@
 
 #include "vw/core/reductions/lda_core.h"
 
+#include "details/lda/expdigammify_simd.h"
 #include "vw/common/future_compat.h"
 #include "vw/common/random.h"
 #include "vw/core/crossplat_compat.h"
@@ -28,6 +29,7 @@ VW_WARNING_STATE_POP
 #include "vw/core/reductions/gd.h"
 #include "vw/core/reductions/mwt.h"
 #include "vw/core/shared_data.h"
+#include "vw/core/thread_pool.h"
 #include "vw/core/vw.h"
 #include "vw/core/vw_versions.h"
 #include "vw/io/logger.h"
@@ -42,6 +44,7 @@ VW_WARNING_STATE_POP
 #include <cstdio>
 #include <cstring>
 #include <fstream>
+#include <future>
 #include <numeric>
 #include <queue>
 #include <vector>
@@ -58,6 +61,13 @@ enum class lda_math_mode : int
   USE_FAST_APPROX
 };
 
+enum class lda_simd_type
+{
+  SSE,
+  AVX2,
+  AVX512
+};
+
 class index_feature
 {
 public:
@@ -66,6 +76,16 @@ public:
   bool operator<(const index_feature b) const { return f.weight_index < b.f.weight_index; }
 };
 
+// Scratch space for the variational inference of a single document. Each block of documents
+// processed concurrently in the E-step owns one of these.
+class lda_doc_scratch
+{
+public:
+  VW::v_array<float> new_gamma;
+  VW::v_array<float> old_gamma;
+  VW::v_array<float> Elogtheta;  // NOLINT
+};
+
 class lda
 {
 public:
@@ -76,8 +96,8 @@ public:
   float lda_epsilon = 0.f;
   size_t minibatch = 0;
   lda_math_mode mmode;
+  lda_simd_type simd_type = lda_simd_type::SSE;
 
-  VW::v_array<float> Elogtheta;  // NOLINT
   VW::v_array<float> decay_levels;
   VW::v_array<float> total_new;
   VW::v_array<float> total_lambda;
@@ -86,6 +106,13 @@ public:
   VW::v_array<float> v;
   std::vector<index_feature> sorted_features;
 
+  // The E-step of a minibatch is run over blocks of documents on this pool. A pool with no threads
+  // runs every block on the learner thread.
+  std::unique_ptr<VW::thread_pool> e_step_pool;
+  std::vector<lda_doc_scratch> doc_scratch;
+  std::vector<float> doc_scores;
+  std::vector<std::future<void>> e_step_futures;
+
   std::vector<VW::example*> batch_buffer;
   // If the epoch size is greater than 1, the examples in the batch need to be saved somewhere.
   std::vector<std::unique_ptr<VW::example>> saved_batch_examples;
@@ -606,6 +633,18 @@ void lda::expdigammify(VW::workspace& all_, float* gamma)
       ldamath::expdigammify<float, lda_math_mode::USE_PRECISE>(all_, gamma, UNDERFLOW_THRESHOLD, 0.0f);
       break;
     case lda_math_mode::USE_SIMD:
+#ifdef BUILD_LDA_WITH_SIMD
+      if (simd_type == lda_simd_type::AVX512)
+      {
+        VW::reductions::lda::expdigammify_avx512(gamma, all_.lda, UNDERFLOW_THRESHOLD);
+        break;
+      }
+      if (simd_type == lda_simd_type::AVX2)
+      {
+        VW::reductions::lda::expdigammify_avx2(gamma, all_.lda, UNDERFLOW_THRESHOLD);
+        break;
+      }
+#endif
       ldamath::expdigammify<float, lda_math_mode::USE_SIMD>(all_, gamma, UNDERFLOW_THRESHOLD, 0.0f);
       break;
     default:
@@ -625,6 +664,18 @@ void lda::expdigammify_2(VW::workspace& all_, float* gamma, float* norm)
       ldamath::expdigammify_2<float, lda_math_mode::USE_PRECISE>(all_, gamma, norm, UNDERFLOW_THRESHOLD);
       break;
     case lda_math_mode::USE_SIMD:
+#ifdef BUILD_LDA_WITH_SIMD
+      if (simd_type == lda_simd_type::AVX512)
+      {
+        VW::reductions::lda::expdigammify_2_avx512(gamma, norm, all_.lda, UNDERFLOW_THRESHOLD);
+        break;
+      }
+      if (simd_type == lda_simd_type::AVX2)
+      {
+        VW::reductions::lda::expdigammify_2_avx2(gamma, norm, all_.lda, UNDERFLOW_THRESHOLD);
+        break;
+      }
+#endif
       ldamath::expdigammify_2<float, lda_math_mode::USE_SIMD>(all_, gamma, norm, UNDERFLOW_THRESHOLD);
       break;
     default:
@@ -678,21 +729,19 @@ static inline float find_cw(lda& l, float* u_for_w, float* v)
   return 1.0f / std::inner_product(u_for_w, u_for_w + l.topics, v, 0.0f);
 }
 
-namespace
-{
-// Effectively, these are static and not visible outside the compilation unit.
-VW::v_array<float> new_gamma;
-VW::v_array<float> old_gamma;
-}  // namespace
-
 // Returns an estimate of the part of the variational bound that
 // doesn't have to do with beta for the entire corpus for the current
 // setting of lambda based on the document passed in. The value is
 // divided by the total number of words in the document This can be
 // used as a (possibly very noisy) estimate of held-out likelihood.
-float lda_loop(lda& l, VW::v_array<float>& Elogtheta, float* v, VW::example* ec, float)
+//
+// Only reads the topic weights, so documents of a minibatch can run concurrently as long as each
+// uses its own scratch and v.
+float lda_loop(lda& l, lda_doc_scratch& scratch, float* v, VW::example* ec)
 {
   parameters& weights = l.all->weights;
+  auto& new_gamma = scratch.new_gamma;
+  auto& old_gamma = scratch.old_gamma;
   new_gamma.clear();
   old_gamma.clear();
 
@@ -734,7 +783,7 @@ float lda_loop(lda& l, VW::v_array<float>& Elogtheta, float* v, VW::example* ec,
   ec->pred.scalars.resize(l.topics);
   memcpy(ec->pred.scalars.begin(), new_gamma.begin(), l.topics * sizeof(float));
 
-  score += theta_kl(l, Elogtheta, new_gamma.begin());
+  score += theta_kl(l, scratch.Elogtheta, new_gamma.begin());
 
   return score / doc_length;
 }
@@ -901,15 +950,36 @@ void learn_batch(lda& l, std::vector<example*>& batch)
     l.expdigammify_2(*l.all, u_for_w, l.digammas.begin());
   }
 
+  // E-step: documents are independent given the topic weights, so split the minibatch into
+  // contiguous blocks and infer each block on the pool.
+  l.doc_scores.resize(batch_size);
+  const size_t num_blocks = std::min(batch_size, l.doc_scratch.size());
+  const size_t block_size = (batch_size + num_blocks - 1) / num_blocks;
+  for (size_t block = 0; block < num_blocks; block++)
+  {
+    const size_t doc_begin = block * block_size;
+    const size_t doc_end = std::min(batch_size, doc_begin + block_size);
+    lda_doc_scratch* scratch = &l.doc_scratch[block];
+    l.e_step_futures.emplace_back(l.e_step_pool->submit(
+        [&l, &batch, scratch, doc_begin, doc_end]()
+        {
+          for (size_t d = doc_begin; d < doc_end; d++)
+          {
+            l.doc_scores[d] = lda_loop(l, *scratch, &(l.v[d * l.all->lda]), batch[d]);
+          }
+        }));
+  }
+  for (auto& ft : l.e_step_futures) { ft.get(); }
+  l.e_step_futures.clear();
+
   for (size_t d = 0; d < batch_size; d++)
   {
-    float score = lda_loop(l, l.Elogtheta, &(l.v[d * l.all->lda]), batch[d], l.all->power_t);
     if (l.all->audit) { VW::details::print_audit_features(*l.all, *batch[d]); }
     // If the doc is empty, give it loss of 0.
     if (l.doc_lengths[d] > 0)
     {
-      l.all->sd->sum_loss -= score;
-      l.all->sd->sum_loss_since_last_dump -= score;
+      l.all->sd->sum_loss -= l.doc_scores[d];
+      l.all->sd->sum_loss_since_last_dump -= l.doc_scores[d];
     }
   }
 
@@ -1294,6 +1364,8 @@ base_learner* VW::reductions::lda_setup(VW::setup_base_i& stack_builder)
   int64_t math_mode;
   uint64_t topics;
   uint64_t minibatch;
+  uint64_t lda_threads;
+  bool use_explicit_simd = false;
   new_options.add(make_option("lda", topics).keep().necessary().help("Run lda with <int> topics"))
       .add(make_option("lda_alpha", ld->lda_alpha)
                .keep()
@@ -1310,15 +1382,40 @@ base_learner* VW::reductions::lda_setup(VW::setup_base_i& stack_builder)
                .default_value(static_cast<int64_t>(lda_math_mode::USE_SIMD))
                .one_of({0, 1, 2})
                .help("Math mode: 0=simd, 1=accuracy, 2=fast-approx"))
-      .add(make_option("metrics", ld->compute_coherence_metrics).help("Compute metrics"));
+      .add(make_option("metrics", ld->compute_coherence_metrics).help("Compute metrics"))
+      .add(make_option("lda_threads", lda_threads)
+               .default_value(0)
+               .help("Number of threads used to run inference over the documents of a minibatch. 0 runs it on the "
+                     "learner thread"))
+      .add(make_option("lda_hint_explicit_simd", use_explicit_simd)
+               .experimental()
+               .help("Use AVX2 or AVX-512 kernels for math mode 0 when the CPU supports them (x86 Linux only)"));
 
   if (!options.add_parse_and_check_necessary(new_options)) { return nullptr; }
+  // Sparse weights insert on lookup, so E-step workers cannot share them.
+  if (lda_threads > 1 && all.weights.sparse)
+  {
+    THROW("--lda_threads greater than 1 cannot be used with --sparse_weights");
+  }
 
   // Convert from int to corresponding enum value.
   ld->mmode = static_cast<lda_math_mode>(math_mode);
   ld->topics = VW::cast_to_smaller_type<size_t>(topics);
   ld->minibatch = VW::cast_to_smaller_type<size_t>(minibatch);
 
+  ld->e_step_pool = VW::make_unique<VW::thread_pool>(VW::cast_to_smaller_type<size_t>(lda_threads));
+  ld->doc_scratch.resize(std::max(size_t(1), ld->e_step_pool->size()));
+
+#ifdef BUILD_LDA_WITH_SIMD
+  if (use_explicit_simd)
+  {
+    if (VW::reductions::lda::cpu_supports_avx512()) { ld->simd_type = lda_simd_type::AVX512; }
+    else if (VW::reductions::lda::cpu_supports_avx2()) { ld->simd_type = lda_simd_type::AVX2; }
+  }
+#else
+  _UNUSED(use_explicit_simd);
+#endif
+
   all.lda = static_cast<uint32_t>(ld->topics);
   ld->sorted_features = std::vector<index_feature>();
   ld->total_lambda_init = false;
@@ -113,6 +113,50 @@ void list_to_json_file(const std::string& filename, const VW::metric_sink& metri
   else { logger.err_warn("skipping metrics. could not open file for metrics: {}", filename); }
 }
 
+uint64_t profiled_ticks(const VW::details::learner_profile& profile)
+{
+  return profile.learn.ticks + profile.predict.ticks + profile.multipredict.ticks;
+}
+
+void insert_profile_metrics(VW::workspace& all, const base_learner* top, VW::metric_sink& metrics)
+{
+  VW::metric_sink profile;
+  profile.set_string("tick_source", VW::details::profile_tick_source());
+  profile.set_uint("tick_sample_interval", VW::details::PROFILE_SAMPLE_INTERVAL);
+  const auto& stages = *all.example_parser->profile;
+  profile.set_uint("parse_calls", stages.parse.calls);
+  profile.set_uint("parse_ticks", stages.parse.ticks);
+  profile.set_uint("setup_example_calls", stages.setup_example.calls);
+  profile.set_uint("setup_example_ticks", stages.setup_example.ticks);
+  profile.set_uint("finish_example_calls", stages.finish_example.calls);
+  profile.set_uint("finish_example_ticks", stages.finish_example.ticks);
+
+  // Keyed by depth, from the top of the profiled stack, so that repeated reduction names stay distinct.
+  VW::metric_sink reductions;
+  size_t depth = 0;
+  for (const auto* l = top; l != nullptr && l->get_profile() != nullptr; l = l->get_learn_base(), ++depth)
+  {
+    const auto& counters = *l->get_profile();
+    const auto* base = l->get_learn_base();
+    const uint64_t base_ticks =
+        (base != nullptr && base->get_profile() != nullptr) ? profiled_ticks(*base->get_profile()) : 0;
+    const uint64_t ticks = profiled_ticks(counters);
+
+    VW::metric_sink reduction;
+    reduction.set_uint("learn_calls", counters.learn.calls);
+    reduction.set_uint("learn_ticks", counters.learn.ticks);
+    reduction.set_uint("predict_calls", counters.predict.calls);
+    reduction.set_uint("predict_ticks", counters.predict.ticks);
+    reduction.set_uint("multipredict_calls", counters.multipredict.calls);
+    reduction.set_uint("multipredict_ticks", counters.multipredict.ticks);
+    // Time not spent in the learn, predict and multipredict calls of the base.
+    reduction.set_uint("self_ticks", ticks > base_ticks ? ticks - base_ticks : 0);
+    reductions.set_metric_sink(fmt::format("{}_{}", depth, l->get_name()), std::move(reduction));
+  }
+  profile.set_metric_sink("reductions", std::move(reductions));
+  metrics.set_metric_sink("hot_path_profile", std::move(profile));
+}
+
 void persist(metrics_data& data, VW::metric_sink& metrics)
 {
   metrics.set_uint("total_predict_calls", data.predict_count);
@@ -162,10 +206,16 @@ VW::LEARNER::base_learner* VW::reductions::metrics_setup(VW::setup_base_i& stack
   auto data = VW::make_unique<metrics_data>();
 
   std::string out_file;
+  bool profile_hot_path = false;
   option_group_definition new_options("[Reduction] Debug Metrics");
-  new_options.add(make_option("extra_metrics", out_file)
-                      .necessary()
-                      .help("Specify filename to write metrics to. Note: There is no fixed schema"));
+  new_options
+      .add(make_option("extra_metrics", out_file)
+               .necessary()
+               .help("Specify filename to write metrics to. Note: There is no fixed schema"))
+      .add(make_option("profile_hot_path", profile_hot_path)
+               .experimental()
+               .help("Also report the time spent parsing, setting up and finishing examples and in the learn, "
+                     "predict and multipredict calls of each reduction"));
 
   if (!options.add_parse_and_check_necessary(new_options)) { return nullptr; }
 
@@ -174,6 +224,14 @@ VW::LEARNER::base_learner* VW::reductions::metrics_setup(VW::setup_base_i& stack
 
   auto* base_learner = stack_builder.setup_base_learner();
 
+  if (profile_hot_path)
+  {
+    all.example_parser->profile = VW::make_unique<VW::details::hot_path_profile>();
+    base_learner->enable_profile();
+    all.global_metrics.register_metrics_callback([&all, base_learner](VW::metric_sink& metrics)
+        { insert_profile_metrics(all, base_learner, metrics); });
+  }
+
   if (base_learner->is_multiline())
   {
     auto* l = make_reduction_learner(std::move(data), as_multiline(base_learner),
@@ -150,7 +150,7 @@ const offset_tree::scores_t& offset_tree::predict(LEARNER::single_learner& base,
     return _scores;
   }
 
-  const VW::cb_label saved_label = ec.l.cb;
+  VW::cb_label saved_label = std::move(ec.l.cb);
   ec.l.cb.costs.clear();
 
   // Get predictions for all internal nodes
@@ -161,7 +161,7 @@ const offset_tree::scores_t& offset_tree::predict(LEARNER::single_learner& base,
   }
 
   // Restore example label.
-  ec.l.cb = saved_label;
+  ec.l.cb = std::move(saved_label);
 
   // use a offset helper to deal with start index offset
   offset_helper<predict_buffer_t> buffer_helper(_prediction_buffer, t.leaf_node_count());
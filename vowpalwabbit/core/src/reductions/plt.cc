@@ -58,8 +58,11 @@ public:
   // for prediction
   float threshold = 0.f;
   uint32_t top_k = 0;
+  uint32_t beam_width = 0;                    // if > 0, top-k prediction uses level-wise beam search
   std::vector<VW::polyprediction> node_pred;  // for storing results of base.multipredict
   std::vector<node> node_queue;               // container for queue used for both types of predictions
+  std::vector<node> beam_children;            // children of the current beam frontier
+  std::vector<node> beam_leaves;              // leaves reached by the beam search
   bool probabilities = false;
 
   // for measuring predictive performance
@@ -167,6 +170,77 @@ inline float predict_node(uint32_t n, single_learner& base, VW::example& ec)
   return sigmoid(ec.partial_prediction);
 }
 
+// Scores the children of every node in parents, which must be internal nodes sorted by node number. Children of
+// consecutive nodes are consecutive as well, so each run of consecutive parents is scored with one multipredict call.
+void predict_children(
+    plt& p, single_learner& base, VW::example& ec, const std::vector<node>& parents, std::vector<node>& children)
+{
+  ec.l.simple = {FLT_MAX};
+  ec.ex_reduction_features.template get<VW::simple_label_reduction_features>().reset_to_default();
+
+  size_t run_begin = 0;
+  while (run_begin < parents.size())
+  {
+    size_t run_end = run_begin + 1;
+    while (run_end < parents.size() && parents[run_end].n == parents[run_end - 1].n + 1) { ++run_end; }
+
+    const uint32_t first_child = p.kary * parents[run_begin].n + 1;
+    const size_t count = (run_end - run_begin) * p.kary;
+    if (p.node_pred.size() < count) { p.node_pred.resize(count); }
+    base.multipredict(ec, first_child, count, p.node_pred.data(), false);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+      const uint32_t n_child = first_child + static_cast<uint32_t>(i);
+      if (n_child < p.t)
+      {
+        children.push_back({n_child, parents[run_begin + i / p.kary].p * sigmoid(p.node_pred[i].scalar)});
+      }
+    }
+    run_begin = run_end;
+  }
+}
+
+// Top-k prediction keeping at most beam_width nodes on each level of the tree, so the number of node evaluations is
+// bounded by beam_width * kary * depth. Leaves reached on the way are ranked at the end.
+void predict_top_k_beam(plt& p, single_learner& base, VW::example& ec, VW::polyprediction& pred)
+{
+  p.beam_leaves.clear();
+  const node root = {0, predict_node(0, base, ec)};
+  if (p.ti == 0) { p.beam_leaves.push_back(root); }
+  else { p.node_queue.push_back(root); }
+
+  const auto by_probability = [](const node& l, const node& r) { return r < l; };
+  while (!p.node_queue.empty())
+  {
+    std::sort(p.node_queue.begin(), p.node_queue.end(), [](const node& l, const node& r) { return l.n < r.n; });
+    p.beam_children.clear();
+    predict_children(p, base, ec, p.node_queue, p.beam_children);
+
+    p.node_queue.clear();
+    for (const auto& child : p.beam_children)
+    {
+      if (child.n < p.ti) { p.node_queue.push_back(child); }
+      else { p.beam_leaves.push_back(child); }
+    }
+    if (p.node_queue.size() > p.beam_width)
+    {
+      std::nth_element(p.node_queue.begin(), p.node_queue.begin() + p.beam_width, p.node_queue.end(), by_probability);
+      p.node_queue.resize(p.beam_width);
+    }
+  }
+
+  const size_t num_predicted = std::min<size_t>(p.top_k, p.beam_leaves.size());
+  std::partial_sort(
+      p.beam_leaves.begin(), p.beam_leaves.begin() + num_predicted, p.beam_leaves.end(), by_probability);
+  for (size_t i = 0; i < num_predicted; ++i)
+  {
+    uint32_t l = p.beam_leaves[i].n - p.ti;
+    if (p.probabilities) { pred.a_s.push_back({l, p.beam_leaves[i].p}); }
+    pred.multilabels.label_v.push_back(l);
+  }
+}
+
 template <bool threshold>
 void predict(plt& p, single_learner& base, VW::example& ec)
 {
@@ -235,6 +309,9 @@ void predict(plt& p, single_learner& base, VW::example& ec)
     p.fn += static_cast<uint32_t>(p.true_labels.size()) - tp;
   }
 
+  // top-k prediction with beam search
+  else if (p.beam_width > 0) { predict_top_k_beam(p, base, ec, pred); }
+
   // top-k prediction
   else
   {
@@ -270,13 +347,15 @@ void predict(plt& p, single_learner& base, VW::example& ec)
         if (pred.multilabels.label_v.size() >= p.top_k) { break; }
       }
     }
+  }
 
-    // calculate precision and recall at
+  if (!threshold)
+  {
+    // calculate precision and recall at, the beam search can return fewer than top_k labels
     float tp_at = 0;
     for (size_t i = 0; i < p.top_k; ++i)
     {
-      uint32_t pred_label = pred.multilabels.label_v[i];
-      if (p.true_labels.count(pred_label)) { tp_at += 1; }
+      if (i < pred.multilabels.label_v.size() && p.true_labels.count(pred.multilabels.label_v[i])) { tp_at += 1; }
       p.p_at[i] += tp_at / (i + 1);
       if (p.true_labels.size() > 0) { p.r_at[i] += tp_at / p.true_labels.size(); }
     }
@@ -408,6 +487,10 @@ base_learner* VW::reductions::plt_setup(VW::setup_base_i& stack_builder)
       .add(make_option("top_k", tree->top_k)
                .default_value(0)
                .help("Predict top-<k> labels instead of labels above threshold"))
+      .add(make_option("top_k_beam_width", tree->beam_width)
+               .default_value(0)
+               .help("Use beam search keeping <w> nodes per tree level for top-k prediction. The children of the whole "
+                     "beam are scored with batched base learner calls. 0 runs exact best-first search"))
       .add(make_option("probabilities", tree->probabilities).help("Predict probabilities for the predicted labels"))
       .add(make_option("plt_force_load_legacy_model", tree->force_load_legacy_model)
                .help("Force the loading of a pre 9.7 model. This option is a migration measure and will be removed in "
@@ -436,7 +519,11 @@ base_learner* VW::reductions::plt_setup(VW::setup_base_i& stack_builder)
     *(all.trace_message) << "PLT k = " << tree->k << "\nkary_tree = " << tree->kary << std::endl;
     if (!all.training)
     {
-      if (tree->top_k > 0) { *(all.trace_message) << "top_k = " << tree->top_k << std::endl; }
+      if (tree->top_k > 0)
+      {
+        *(all.trace_message) << "top_k = " << tree->top_k << std::endl;
+        if (tree->beam_width > 0) { *(all.trace_message) << "top_k_beam_width = " << tree->beam_width << std::endl; }
+      }
       else { *(all.trace_message) << "threshold = " << tree->threshold << std::endl; }
     }
   }
@@ -445,6 +532,10 @@ base_learner* VW::reductions::plt_setup(VW::setup_base_i& stack_builder)
   tree->nodes_time.resize(tree->t);
   std::fill(tree->nodes_time.begin(), tree->nodes_time.end(), all.initial_t);
   tree->node_pred.resize(tree->kary);
+  if (tree->top_k > 0 && tree->beam_width > 0 && tree->beam_width < tree->top_k)
+  {
+    THROW("--top_k_beam_width must be at least --top_k, but got " << tree->beam_width << " < " << tree->top_k);
+  }
   if (tree->top_k > 0)
   {
     tree->p_at.resize(tree->top_k);
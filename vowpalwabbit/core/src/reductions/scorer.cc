@@ -10,6 +10,7 @@
 #include "vw/core/global_data.h"
 #include "vw/core/learner.h"
 #include "vw/core/loss_functions.h"
+#include "vw/core/reductions/gd.h"
 #include "vw/core/setup_base.h"
 
 #include <cfloat>
@@ -21,14 +22,24 @@ using namespace VW::config;
 
 namespace
 {
-class scorer
+using VW::reductions::details::scorer;
+
+// Matches gd's predict when it runs without l1 truncation or audit. The time is charged to gd's predict counter so
+// that --profile_hot_path reports the same split as when the scorer calls into gd.
+inline void predict_with_plain_gd(VW::workspace& all, VW::LEARNER::single_learner& gd, VW::example& ec)
 {
-public:
-  scorer(VW::workspace* all) : all(all) {}
-  VW::workspace* all;
-};  // for set_minmax, loss
+  auto* profile = gd.get_profile();
+  VW::details::profile_scope timer(profile != nullptr ? &profile->predict : nullptr);
+  size_t num_interacted_features = 0;
+  ec.partial_prediction = VW::inline_predict(all, ec, num_interacted_features);
+  ec.num_features_from_interactions = num_interacted_features;
+  ec.partial_prediction *= static_cast<float>(all.sd->contraction);
+  ec.pred.scalar = VW::details::finalize_prediction(all.sd, all.logger, ec.partial_prediction);
+}
 
-template <bool is_learn, float (*link)(float in)>
+// When gd_fast_path is set the base is a plain gd learner and predictions are computed inline instead of going
+// through the base learner's function pointer.
+template <bool is_learn, float (*link)(float in), bool gd_fast_path = false>
 void predict_or_learn(scorer& s, VW::LEARNER::single_learner& base, VW::example& ec)
 {
   // Predict does not need set_minmax
@@ -36,6 +47,7 @@ void predict_or_learn(scorer& s, VW::LEARNER::single_learner& base, VW::example&
 
   bool learn = is_learn && ec.l.simple.label != FLT_MAX && ec.weight > 0;
   if (learn) { base.learn(ec); }
+  else if (gd_fast_path) { predict_with_plain_gd(*s.all, base, ec); }
   else { base.predict(ec); }
 
   if (ec.weight > 0 && ec.l.simple.label != FLT_MAX)
@@ -97,18 +109,21 @@ VW::LEARNER::base_learner* VW::reductions::scorer_setup(VW::setup_base_i& stack_
   multipredict_fn_t multipredict_f = multipredict<id>;
   predict_or_learn_fn_t learn_fn;
   predict_or_learn_fn_t predict_fn;
+  predict_or_learn_fn_t gd_fast_predict_fn;
   std::string name = stack_builder.get_setupfn_name(scorer_setup);
 
   if (link == "identity")
   {
     learn_fn = predict_or_learn<true, id>;
     predict_fn = predict_or_learn<false, id>;
+    gd_fast_predict_fn = predict_or_learn<false, id, true>;
     name += "-identity";
   }
   else if (link == "logistic")
   {
     learn_fn = predict_or_learn<true, logistic>;
     predict_fn = predict_or_learn<false, logistic>;
+    gd_fast_predict_fn = predict_or_learn<false, logistic, true>;
     name += "-logistic";
     multipredict_f = multipredict<logistic>;
   }
@@ -116,6 +131,7 @@ VW::LEARNER::base_learner* VW::reductions::scorer_setup(VW::setup_base_i& stack_
   {
     learn_fn = predict_or_learn<true, glf1>;
     predict_fn = predict_or_learn<false, glf1>;
+    gd_fast_predict_fn = predict_or_learn<false, glf1, true>;
     name += "-glf1";
     multipredict_f = multipredict<glf1>;
   }
@@ -123,6 +139,7 @@ VW::LEARNER::base_learner* VW::reductions::scorer_setup(VW::setup_base_i& stack_
   {
     learn_fn = predict_or_learn<true, expf>;
     predict_fn = predict_or_learn<false, expf>;
+    gd_fast_predict_fn = predict_or_learn<false, expf, true>;
     name += "-poisson";
     multipredict_f = multipredict<expf>;
   }
@@ -131,6 +148,13 @@ VW::LEARNER::base_learner* VW::reductions::scorer_setup(VW::setup_base_i& stack_
   auto s = VW::make_unique<scorer>(&all);
   // This always returns a base_learner.
   auto* base = as_singleline(stack_builder.setup_base_learner());
+
+  // scorer -> gd closes most stacks, so skip the dispatch into gd for predictions when gd has no special mode.
+  if (base->get_name() == "gd" && all.reg_mode % 2 == 0 && !all.audit && !all.hash_inv)
+  {
+    predict_fn = gd_fast_predict_fn;
+    s->gd_fast_path = true;
+  }
   auto* l = VW::LEARNER::make_reduction_learner(std::move(s), base, learn_fn, predict_fn, name)
                 .set_learn_returns_prediction(base->learn_returns_prediction)
                 .set_input_label_type(VW::label_type_t::SIMPLE)
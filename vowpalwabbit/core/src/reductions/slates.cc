@@ -40,7 +40,7 @@ void VW::reductions::slates_data::learn_or_predict(VW::LEARNER::multi_learner& b
   std::vector<std::vector<uint32_t>> slot_action_pools(num_slots);
   for (size_t i = 0; i < examples.size(); i++)
   {
-    VW::ccb_label ccb_label;
+    auto& ccb_label = examples[i]->l.conditional_contextual_bandit;
     ccb_label.reset_to_default();
     const auto& slates_label = _stashed_labels[i];
     if (slates_label.type == slates::example_type::SHARED)
@@ -67,9 +67,7 @@ void VW::reductions::slates_data::learn_or_predict(VW::LEARNER::multi_learner& b
 
       if (global_cost_found)
       {
-        ccb_label.outcome = new VW::ccb_outcome();
-        ccb_label.outcome->cost = global_cost;
-        ccb_label.outcome->probabilities.clear();
+        ccb_label.emplace_outcome().cost = global_cost;
 
         for (const auto& action_score : slates_label.probabilities)
         {
@@ -83,7 +81,6 @@ void VW::reductions::slates_data::learn_or_predict(VW::LEARNER::multi_learner& b
     }
 
     ccb_label.weight = slates_label.weight;
-    examples[i]->l.conditional_contextual_bandit = ccb_label;
   }
   VW::LEARNER::multiline_learn_or_predict<is_learn>(base, examples, examples[0]->ft_offset);
 
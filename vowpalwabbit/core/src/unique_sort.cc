@@ -7,6 +7,136 @@
 #include "vw/core/feature_group.h"
 
 #include <algorithm>
+#include <array>
+#include <vector>
+
+namespace
+{
+// Below this many features an insertion sort is faster than the counting passes of the radix sort.
+constexpr size_t RADIX_SORT_MIN_SIZE = 64;
+constexpr unsigned RADIX_DIGIT_BITS = 11;
+constexpr size_t RADIX_BUCKETS = size_t{1} << RADIX_DIGIT_BITS;
+
+class sort_entry
+{
+public:
+  uint64_t key;
+  VW::feature_index index;
+  VW::feature_value value;
+};
+
+bool has_sorted_unique_indices(const VW::features& fs, uint64_t parse_mask)
+{
+  for (size_t i = 1; i < fs.indices.size(); ++i)
+  {
+    if ((fs.indices[i - 1] & parse_mask) >= (fs.indices[i] & parse_mask)) { return false; }
+  }
+  return true;
+}
+
+// Audit strings and multiple namespace extents would have to be permuted too, those groups use features::sort.
+bool can_radix_sort(const VW::features& fs)
+{
+  if (!fs.space_names.empty()) { return false; }
+  const auto& extents = fs.namespace_extents;
+  return extents.empty() ||
+      (extents.size() == 1 && extents[0].begin_index == 0 && extents[0].end_index == fs.indices.size());
+}
+
+unsigned significant_bits(uint64_t mask)
+{
+  unsigned bits = 0;
+  while (bits < 64 && (mask >> bits) != 0) { ++bits; }
+  return bits;
+}
+
+// The order of features::sort: by masked index, then by value.
+bool entry_less(const sort_entry& first, const sort_entry& second)
+{
+  return first.key < second.key || (first.key == second.key && first.value < second.value);
+}
+
+void insertion_sort(std::vector<sort_entry>::iterator begin, std::vector<sort_entry>::iterator end)
+{
+  for (auto it = begin; it != end; ++it)
+  {
+    const auto entry = *it;
+    auto dest = it;
+    for (; dest != begin && entry_less(entry, *(dest - 1)); --dest) { *dest = *(dest - 1); }
+    *dest = entry;
+  }
+}
+
+// Stable least significant digit first radix sort on the keys, which are below 2^key_bits.
+void radix_sort(std::vector<sort_entry>& entries, std::vector<sort_entry>& scratch, unsigned key_bits)
+{
+  scratch.resize(entries.size());
+  std::array<size_t, RADIX_BUCKETS> offsets;
+  for (unsigned shift = 0; shift < key_bits; shift += RADIX_DIGIT_BITS)
+  {
+    offsets.fill(0);
+    for (const auto& entry : entries) { offsets[(entry.key >> shift) & (RADIX_BUCKETS - 1)]++; }
+
+    // A digit shared by every key leaves the order unchanged.
+    bool single_bucket = false;
+    size_t start = 0;
+    for (auto& offset : offsets)
+    {
+      if (offset == entries.size()) { single_bucket = true; }
+      const auto count = offset;
+      offset = start;
+      start += count;
+    }
+    if (single_bucket) { continue; }
+
+    for (const auto& entry : entries) { scratch[offsets[(entry.key >> shift) & (RADIX_BUCKETS - 1)]++] = entry; }
+    entries.swap(scratch);
+  }
+}
+
+// Same result as features::sort followed by unique_features: ordered by masked index then value, with repeats of the
+// same unmasked index next to each other reduced to the first one.
+void radix_unique_sort(VW::features& fs, uint64_t parse_mask)
+{
+  // Reused across calls so that sorting does not allocate once warmed up.
+  static thread_local std::vector<sort_entry> entries;
+  static thread_local std::vector<sort_entry> scratch;
+
+  entries.clear();
+  for (size_t i = 0; i < fs.indices.size(); ++i)
+  {
+    entries.push_back(sort_entry{fs.indices[i] & parse_mask, fs.indices[i], fs.values[i]});
+  }
+  if (entries.size() < RADIX_SORT_MIN_SIZE) { insertion_sort(entries.begin(), entries.end()); }
+  else
+  {
+    radix_sort(entries, scratch, significant_bits(parse_mask));
+    // The radix sort only orders by key, runs of equal keys are short and sorted by value afterwards.
+    for (auto run = entries.begin(); run != entries.end();)
+    {
+      auto run_end = run + 1;
+      while (run_end != entries.end() && run_end->key == run->key) { ++run_end; }
+      if (run_end - run > 1) { insertion_sort(run, run_end); }
+      run = run_end;
+    }
+  }
+
+  size_t unique_count = 0;
+  float sum_feat_sq_of_removed = 0.f;
+  for (const auto& entry : entries)
+  {
+    if (unique_count > 0 && fs.indices[unique_count - 1] == entry.index)
+    {
+      sum_feat_sq_of_removed += entry.value * entry.value;
+      continue;
+    }
+    fs.indices[unique_count] = entry.index;
+    fs.values[unique_count] = entry.value;
+    ++unique_count;
+  }
+  fs.truncate_to(unique_count, sum_feat_sq_of_removed);
+}
+}  // namespace
 
 void VW::unique_features(features& fs, int max)
 {
@@ -51,7 +181,10 @@ void VW::unique_sort_features(uint64_t parse_mask, VW::example& ae)
 {
   for (features& fs : ae)
   {
-    if (fs.sort(parse_mask)) { unique_features(fs); }
+    // Namespaces that are already in order, such as most of those read back from a cache, are left untouched.
+    if (has_sorted_unique_indices(fs, parse_mask)) { continue; }
+    if (can_radix_sort(fs)) { radix_unique_sort(fs, parse_mask); }
+    else if (fs.sort(parse_mask)) { unique_features(fs); }
   }
 
   ae.sorted = true;
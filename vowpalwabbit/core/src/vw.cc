@@ -24,6 +24,7 @@
 #include "vw/text_parser/parse_example_text.h"
 
 #include <iostream>
+#include <set>
 
 namespace
 {
@@ -31,7 +32,7 @@ namespace
 std::unique_ptr<VW::workspace> initialize_internal(
     std::unique_ptr<VW::config::options_i, VW::options_deleter_type> options, VW::io_buf* model, bool skip_model_load,
     VW::trace_message_t trace_listener, void* trace_context, VW::io::logger* custom_logger,
-    std::unique_ptr<VW::setup_base_i> setup_base = nullptr)
+    std::unique_ptr<VW::setup_base_i> setup_base = nullptr, const VW::parameters* shared_weights = nullptr)
 {
   // Set up logger as early as possible
   auto all = VW::details::parse_args(std::move(options), trace_listener, trace_context, custom_logger);
@@ -58,6 +59,8 @@ std::unique_ptr<VW::workspace> initialize_internal(
 
     VW::details::parse_modules(*all->options, *all, interactions_settings_duplicated, dictionary_namespaces);
     VW::details::instantiate_learner(*all, std::move(setup_base));
+    // Shared weights are attached before the sources are parsed so that the regressor is never allocated.
+    if (shared_weights != nullptr) { all->weights.shallow_copy(*shared_weights); }
     VW::details::parse_sources(*all->options, *all, *model, skip_model_load);
   }
   catch (VW::save_load_model_exception& e)
@@ -337,6 +340,50 @@ std::unique_ptr<VW::workspace> VW::seed_vw_model(VW::workspace& vw_model, const
   return new_model;
 }
 
+std::unique_ptr<VW::workspace> VW::create_inference_context(
+    VW::workspace& model, const std::vector<std::string>& extra_args, VW::io::logger* custom_logger)
+{
+  if (model.weights.sparse) { THROW("Inference contexts require dense weights, sparse weights are modified on read"); }
+
+  // Only the options that define the model and how features are generated are carried over. Sources, outputs and
+  // training options of the model's workspace do not apply to a context.
+  const std::set<std::string> feature_options = {"bit_precision", "ngram", "skips", "affix", "spelling", "dictionary",
+      "dictionary_path", "experimental_full_name_interactions"};
+  config::cli_options_serializer serializer;
+  for (auto const& option : model.options->get_all_options())
+  {
+    if (model.options->was_supplied(option->m_name) &&
+        (option->m_keep || feature_options.count(option->m_name) != 0))
+    {
+      serializer.add(*option);
+    }
+  }
+
+  // The context is set up for training when the model is, so that reductions choose the same weight stride, for
+  // example gd keeps the adaptive and normalized state only when training. It is made test only once it is set up.
+  auto serialized_options = VW::split_command_line(serializer.str());
+  if (!model.training) { serialized_options.emplace_back("--testonly"); }
+  serialized_options.insert(serialized_options.end(), extra_args.begin(), extra_args.end());
+
+  std::unique_ptr<config::options_i, options_deleter_type> options(
+      new VW::config::options_cli(serialized_options), [](VW::config::options_i* ptr) { delete ptr; });
+
+  auto context = initialize_internal(std::move(options), nullptr, true /* skip model load */, nullptr, nullptr,
+      custom_logger, nullptr, &model.weights);
+
+  // Predictions read the label range and scaling from shared_data, but update its counters, so each context gets
+  // its own copy.
+  *context->sd = *model.sd;
+  context->model_file_ver = model.model_file_ver;
+  context->training = false;
+  if (context->l->increment != model.l->increment)
+  {
+    THROW("The inference context does not lay out its weights like the model, extra_args must not change the stack");
+  }
+
+  return context;
+}
+
 VW::workspace* VW::initialize_with_builder(const std::string& s, io_buf* model, bool skip_model_load,
     VW::trace_message_t trace_listener, void* trace_context, std::unique_ptr<VW::setup_base_i> setup_base)
 {
@@ -0,0 +1,110 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/config/options_cli.h"
+#include "vw/core/learner.h"
+#include "vw/core/shared_data.h"
+#include "vw/core/vw.h"
+#include "vw/test_common/test_common.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+std::unique_ptr<VW::workspace> train_bfgs_in_memory(const std::string& threads)
+{
+  auto vw = VW::initialize(vwtest::make_args("--quiet", "--bfgs", "--passes", "6", "--holdout_off", "--bfgs_in_memory",
+      "--bfgs_threads", threads, "-b", "10", "-q", "ab"));
+
+  for (int i = 0; i < 64; i++)
+  {
+    std::string line = std::to_string((i % 3) - 1) + " |a x" + std::to_string(i % 5) + ":" +
+        std::to_string(0.5f + (i % 7) * 0.25f) + " |b y" + std::to_string(i % 4) + " z" + std::to_string(i % 9);
+    auto* ex = VW::read_example(*vw, line);
+    vw->learn(*ex);
+    vw->finish_example(*ex);
+  }
+
+  // The first pass ends here, the remaining ones are run over the examples held in memory.
+  vw->current_pass++;
+  vw->l->end_pass();
+  return vw;
+}
+
+std::unique_ptr<VW::workspace> train_bfgs_from_file(const std::string& data_file, std::vector<std::string> extra_args)
+{
+  std::vector<std::string> args = {
+      "--quiet", "--no_stdin", "--bfgs", "--passes", "6", "--holdout_off", "-b", "10", "-q", "ab", "-d", data_file};
+  args.insert(args.end(), extra_args.begin(), extra_args.end());
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+  VW::start_parser(*vw);
+  VW::LEARNER::generic_driver(*vw);
+  VW::end_parser(*vw);
+  return vw;
+}
+}  // namespace
+
+TEST(Bfgs, InMemoryPassesRunToCompletion)
+{
+  auto vw = train_bfgs_in_memory("1");
+  EXPECT_GT(vw->current_pass, 1);
+  EXPECT_TRUE(vw->early_terminate);
+}
+
+TEST(Bfgs, ThreadedInMemoryPassesMatchSingleThreaded)
+{
+  auto single = train_bfgs_in_memory("1");
+  auto threaded = train_bfgs_in_memory("3");
+
+  EXPECT_EQ(single->current_pass, threaded->current_pass);
+  EXPECT_NEAR(single->sd->sum_loss, threaded->sd->sum_loss, 1e-3 * std::fabs(single->sd->sum_loss));
+
+  auto& single_weights = single->weights.dense_weights;
+  auto& threaded_weights = threaded->weights.dense_weights;
+  for (auto it = single_weights.begin(); it != single_weights.end(); ++it)
+  {
+    EXPECT_NEAR(*it, threaded_weights[it.index()], 1e-3f + 1e-3f * std::fabs(*it));
+  }
+}
+
+TEST(Bfgs, InMemoryPassesMatchCachedPasses)
+{
+  const std::string data_file = ::testing::TempDir() + "bfgs_in_memory_test.txt";
+  {
+    std::ofstream out(data_file);
+    for (int i = 0; i < 64; i++)
+    {
+      out << (i % 3) - 1 << " |a x" << i % 5 << ":" << 0.5f + (i % 7) * 0.25f << " |b y" << i % 4 << " z" << i % 9
+          << "\n";
+    }
+  }
+  const std::string cache_file = data_file + ".cache";
+
+  auto cached = train_bfgs_from_file(data_file, {"--cache_file", cache_file, "-k"});
+  auto in_memory = train_bfgs_from_file(data_file, {"--bfgs_in_memory"});
+  auto threaded = train_bfgs_from_file(data_file, {"--bfgs_in_memory", "--bfgs_threads", "3"});
+
+  EXPECT_GT(cached->current_pass, 1);
+  EXPECT_EQ(in_memory->current_pass, cached->current_pass);
+  EXPECT_FLOAT_EQ(in_memory->sd->sum_loss, cached->sd->sum_loss);
+  EXPECT_EQ(threaded->current_pass, cached->current_pass);
+  EXPECT_NEAR(threaded->sd->sum_loss, cached->sd->sum_loss, 1e-3 * std::fabs(cached->sd->sum_loss));
+
+  auto& cached_weights = cached->weights.dense_weights;
+  for (auto it = cached_weights.begin(); it != cached_weights.end(); ++it)
+  {
+    EXPECT_FLOAT_EQ(in_memory->weights.dense_weights[it.index()], *it);
+    EXPECT_NEAR(threaded->weights.dense_weights[it.index()], *it, 1e-3f + 1e-3f * std::fabs(*it));
+  }
+
+  std::remove(cache_file.c_str());
+  std::remove(data_file.c_str());
+}
@@ -0,0 +1,47 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/learner.h"
+#include "vw/core/reductions/bs.h"
+#include "vw/core/vw.h"
+#include "vw/test_common/test_common.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <string>
+
+TEST(Bs, MultipredictMatchesPerRoundPredict)
+{
+  constexpr size_t NUM_ROUNDS = 4;
+  auto vw = VW::initialize(vwtest::make_args("--bootstrap", std::to_string(NUM_ROUNDS), "--quiet"));
+  for (int i = 0; i < 30; ++i)
+  {
+    const std::string line = std::to_string(i % 3) + " | a" + std::to_string(i % 5) + " b" + std::to_string(i % 7);
+    auto* ex = VW::read_example(*vw, line);
+    vw->learn(*ex);
+    vw->finish_example(*ex);
+  }
+
+  auto* ex = VW::read_example(*vw, " | a1 b2 c");
+  auto& random_state = *vw->get_random_state();
+  const uint64_t state_before = random_state.get_current_state();
+  vw->predict(*ex);
+  const float mean = ex->pred.scalar;
+
+  // bs still draws one weight per round when it scores all rounds in one multipredict call
+  VW::rand_state expected_state(state_before);
+  for (size_t i = 0; i < NUM_ROUNDS; ++i) { VW::reductions::bs::weight_gen(expected_state); }
+  EXPECT_EQ(random_state.get_current_state(), expected_state.get_current_state());
+
+  auto* base = VW::LEARNER::as_singleline(vw->l->get_learner_by_name_prefix("scorer"));
+  float sum = 0.f;
+  for (size_t i = 0; i < NUM_ROUNDS; ++i)
+  {
+    base->predict(*ex, i);
+    sum += ex->pred.scalar;
+  }
+  EXPECT_FLOAT_EQ(mean, sum / NUM_ROUNDS);
+  vw->finish_example(*ex);
+}
@@ -2,6 +2,8 @@
 // individual contributors. All rights reserved. Released under a BSD (revised)
 // license as described in the file LICENSE.
 
+#include "vw/core/gen_cs_example.h"
+#include "vw/core/learner.h"
 #include "vw/core/vw.h"
 #include "vw/test_common/test_common.h"
 
@@ -16,3 +18,87 @@ TEST(CbExploreAdf, ShouldThrowEmptyMultiExample)
   // An empty example collection is invalid and so should throw.
   EXPECT_THROW(vw->learn(example_collection), VW::vw_exception);
 }
+
+TEST(CbExploreAdf, BagMultipredictMatchesPerPolicyPredict)
+{
+  auto vw = VW::initialize(vwtest::make_args("--cb_explore_adf", "--bag", "4", "--quiet", "-q", "sa"));
+
+  const std::vector<std::string> train_lines = {"shared | s_1 s_2", "| a_1 b_1", "| a_2 b_2", "| a_3 b_3"};
+  for (int i = 0; i < 20; ++i)
+  {
+    VW::multi_ex examples;
+    for (const auto& line : train_lines) { examples.push_back(VW::read_example(*vw, line)); }
+    // Move the cost around so the bagged policies disagree
+    examples[1 + i % 3]->l.cb.costs.push_back({static_cast<float>(i % 2), 0, 0.5f});
+    vw->learn(examples);
+    vw->finish_example(examples);
+  }
+
+  VW::multi_ex examples;
+  examples.push_back(VW::read_example(*vw, "shared | s_1 s_2"));
+  examples.push_back(VW::read_example(*vw, "| a_1 b_1"));
+  examples.push_back(VW::read_example(*vw, "| a_2 b_2"));
+  examples.push_back(VW::read_example(*vw, "| a_3 b_3"));
+
+  auto* cb_adf = VW::LEARNER::as_multiline(vw->l->get_learner_by_name_prefix("cb_adf"));
+  std::vector<VW::polyprediction> policy_preds(4);
+  cb_adf->multipredict(examples, 0, 4, policy_preds.data(), true);
+
+  for (size_t i = 0; i < policy_preds.size(); ++i)
+  {
+    cb_adf->predict(examples, i);
+    const auto& expected = examples[0]->pred.a_s;
+    ASSERT_EQ(policy_preds[i].a_s.size(), expected.size());
+    for (size_t j = 0; j < expected.size(); ++j)
+    {
+      EXPECT_EQ(policy_preds[i].a_s[j].action, expected[j].action);
+      EXPECT_FLOAT_EQ(policy_preds[i].a_s[j].score, expected[j].score);
+    }
+  }
+  vw->finish_example(examples);
+}
+
+TEST(CbExploreAdf, CoverMultipredictMatchesPerPolicyPredict)
+{
+  auto vw = VW::initialize(vwtest::make_args("--cb_explore_adf", "--cover", "4", "--quiet", "-q", "sa"));
+
+  const std::vector<std::string> train_lines = {"shared | s_1 s_2", "| a_1 b_1", "| a_2 b_2", "| a_3 b_3"};
+  for (int i = 0; i < 20; ++i)
+  {
+    VW::multi_ex examples;
+    for (const auto& line : train_lines) { examples.push_back(VW::read_example(*vw, line)); }
+    // Move the cost around so the cover policies disagree
+    examples[1 + i % 3]->l.cb.costs.push_back({static_cast<float>(i % 2), 0, 0.5f});
+    vw->learn(examples);
+    vw->finish_example(examples);
+  }
+
+  VW::multi_ex examples;
+  for (const auto& line : train_lines) { examples.push_back(VW::read_example(*vw, line)); }
+
+  // Cover scores its policies 2..cover_size with one call to the cost sensitive learner when predicting
+  auto* cs_ldf = VW::LEARNER::as_multiline(vw->cost_sensitive);
+  std::vector<VW::cb_label> cb_labels;
+  VW::cs_label cs_labels;
+  std::vector<VW::cs_label> prepped_cs_labels;
+  VW::details::gen_cs_example_ips(examples, cs_labels, vw->logger);
+  const uint64_t offset = examples[0]->ft_offset;
+  std::vector<VW::polyprediction> policy_preds(3);
+  VW::details::cs_ldf_multipredict(
+      *cs_ldf, examples, cb_labels, cs_labels, prepped_cs_labels, offset, 2, policy_preds.size(), policy_preds.data());
+
+  for (size_t i = 0; i < policy_preds.size(); ++i)
+  {
+    VW::details::cs_ldf_learn_or_predict<false>(
+        *cs_ldf, examples, cb_labels, cs_labels, prepped_cs_labels, false, offset, i + 2);
+    const auto& expected = examples[0]->pred.a_s;
+    ASSERT_EQ(policy_preds[i].a_s.size(), expected.size());
+    for (size_t j = 0; j < expected.size(); ++j)
+    {
+      EXPECT_EQ(policy_preds[i].a_s[j].action, expected[j].action);
+      EXPECT_FLOAT_EQ(policy_preds[i].a_s[j].score, expected[j].score);
+    }
+  }
+  EXPECT_EQ(examples[0]->ft_offset, offset);
+  vw->finish_example(examples);
+}
@@ -163,3 +163,34 @@ TEST(Ccb, CopyLabel)
   EXPECT_FLOAT_EQ(copied_to->outcome->probabilities[2].score, .25f);
   EXPECT_EQ(copied_to->type, VW::ccb_example_type::SLOT);
 }
+
+TEST(Ccb, ResetLabelKeepsOutcomeForReuse)
+{
+  auto label = VW::make_unique<VW::ccb_label>();
+  parse_ccb_label("ccb slot 1:-2.0:0.5,2:0.25,3:0.25 3,4", *label);
+  const auto* first_outcome = label->outcome;
+  const auto* first_probabilities = label->outcome->probabilities.data();
+  const auto* first_included_actions = label->explicit_included_actions.data();
+
+  // An unlabeled slot still reads as a test label after the reset.
+  parse_ccb_label("ccb slot 3,4", *label);
+  EXPECT_TRUE(label->outcome == nullptr);
+  EXPECT_TRUE(label->is_test_label());
+  EXPECT_EQ(label->explicit_included_actions.data(), first_included_actions);
+
+  parse_ccb_label("ccb slot 2:1.0:0.5,1:0.5", *label);
+  EXPECT_EQ(label->outcome, first_outcome);
+  EXPECT_EQ(label->outcome->probabilities.data(), first_probabilities);
+  EXPECT_FLOAT_EQ(label->outcome->cost, 1.0f);
+  EXPECT_EQ(label->outcome->probabilities.size(), 2);
+  EXPECT_EQ(label->outcome->probabilities[0].action, 2);
+  EXPECT_EQ(label->outcome->probabilities[1].action, 1);
+  EXPECT_EQ(label->explicit_included_actions.size(), 0);
+
+  auto copied_to = VW::make_unique<VW::ccb_label>();
+  *copied_to = *label;
+  parse_ccb_label("ccb shared", *label);
+  *label = *copied_to;
+  EXPECT_EQ(label->outcome, first_outcome);
+  EXPECT_FLOAT_EQ(label->outcome->cost, 1.0f);
+}
@@ -7,11 +7,16 @@
 #include "vw/common/random.h"
 #include "vw/core/example.h"
 #include "vw/core/learner.h"
+#include "vw/core/memory.h"
 #include "vw/core/vw.h"
 #include "vw/test_common/test_common.h"
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -202,6 +207,102 @@ TEST(Emt, ScaleAdd)
   EXPECT_EQ(emt_scale_add(-1, v1, -1, v2), v3);
 }
 
+TEST(Emt, Distance)
+{
+  emt_feats v1;
+  emt_feats v2;
+
+  EXPECT_EQ(emt_distance(v1, v2), 0);
+
+  v1.emplace_back(1, 2);
+  v1.emplace_back(4, -1);
+  v2.emplace_back(1, 2.5);
+  v2.emplace_back(3, 1);
+  v2.emplace_back(7, 2);
+
+  EXPECT_FLOAT_EQ(emt_distance(v1, v2), emt_norm(emt_scale_add(1, v1, -1, v2)));
+  EXPECT_FLOAT_EQ(emt_distance(v1, v2), std::sqrt(.25f + 1 + 1 + 4));
+
+  emt_feats out{{9, 9}};
+  emt_scale_add(1, v1, -1, v2, out);
+  EXPECT_EQ(out, emt_scale_add(1, v1, -1, v2));
+}
+
+TEST(Emt, LeafDistancesMatchDistance)
+{
+  std::vector<std::unique_ptr<emt_example>> memories;
+  auto add_memory = [&memories](emt_feats full)
+  {
+    memories.push_back(VW::make_unique<emt_example>());
+    memories.back()->full = std::move(full);
+  };
+
+  const emt_feats query{{1, 2}, {4, -1}, {6, 0.5}, {9, 3}, {12, -2}, {15, 1}};
+  add_memory(query);
+  add_memory({});
+  add_memory({{1, 2.5}, {3, 1}, {7, 2}});
+  add_memory({{0, 1}, {1, 2}, {4, -1}, {6, 0.25}, {9, 3}, {12, -1}, {15, 1}, {20, 4}, {31, -0.5}});
+  add_memory({{16, 1}, {17, 2}});
+  emt_feats many;
+  for (uint64_t i = 0; i < 40; i++) { many.emplace_back(i, static_cast<float>(i % 7) - 3.f); }
+  add_memory(many);
+
+  std::vector<float> dense_query;
+  std::vector<float> distances;
+  emt_leaf_distances(query, memories, dense_query, distances);
+
+  ASSERT_EQ(distances.size(), memories.size());
+  EXPECT_EQ(distances[0], 0);
+  for (size_t i = 0; i < memories.size(); i++)
+  {
+    const float expected = emt_distance(query, memories[i]->full);
+    EXPECT_NEAR(distances[i], expected, 1e-5f * std::max(1.f, expected)) << "memory " << i;
+  }
+  for (float v : dense_query) { EXPECT_EQ(v, 0); }
+
+  emt_leaf_distances({}, memories, dense_query, distances);
+  for (size_t i = 0; i < memories.size(); i++) { EXPECT_FLOAT_EQ(distances[i], emt_norm(memories[i]->full)); }
+}
+
+TEST(Emt, DistanceScorerPicksNearestMemory)
+{
+  auto vw = VW::initialize(vwtest::make_args("--quiet", "--emt", "--emt_scorer", "distance", "--emt_leaf", "100"));
+  auto* tree = get_emt_tree(*vw);
+
+  for (int i = 0; i < 30; i++)
+  {
+    auto* ex = VW::read_example(*vw,
+        std::to_string(i + 1) + " | a:" + std::to_string(i % 5) + " b:" + std::to_string((i * 7) % 11) +
+            " c:" + std::to_string((i * 3) % 4));
+    vw->learn(*ex);
+    vw->finish_example(*ex);
+  }
+  ASSERT_EQ(tree->root->left, nullptr);
+
+  for (int i = 0; i < 10; i++)
+  {
+    auto* ex = VW::read_example(*vw,
+        " | a:" + std::to_string(i * 0.37) + " b:" + std::to_string(i * 1.1) + " c:" + std::to_string(3 - i * 0.3));
+    const emt_example query(*vw, ex);
+
+    uint32_t expected = 0;
+    float best = FLT_MAX;
+    for (const auto& memory : tree->root->examples)
+    {
+      const float distance = emt_distance(query.full, memory->full);
+      if (distance < best)
+      {
+        best = distance;
+        expected = memory->label;
+      }
+    }
+
+    vw->predict(*ex);
+    EXPECT_EQ(ex->pred.multiclass, expected) << "query " << i;
+    vw->finish_example(*ex);
+  }
+}
+
 TEST(Emt, Abs)
 {
   emt_feats v1;
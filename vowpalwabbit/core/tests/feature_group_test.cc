@@ -125,6 +125,44 @@ TEST(FeatureGroup, SortFeatureGroupTest)
   EXPECT_THAT(fs.namespace_extents, ContainerEq(std::vector<VW::namespace_extent>{{1, 3, 1}, {4, 7, 2}}));
 }
 
+TEST(FeatureGroup, UniqueSortFeaturesMatchesSortThenUnique)
+{
+  const auto parse_mask = (static_cast<uint64_t>(1) << 18) - 1;
+  // Small groups are insertion sorted, large ones radix sorted. Indices above the mask and repeated indices must be
+  // handled as by features::sort.
+  for (size_t size : {5, 300})
+  {
+    VW::example ex;
+    ex.indices.push_back('a');
+    auto& fs = ex.feature_space['a'];
+    fs.start_ns_extent(1);
+    for (size_t i = 0; i < size; ++i)
+    {
+      const uint64_t index = (i * 7919) % 97 + (i % 3 == 0 ? (parse_mask + 1) * i : 0);
+      fs.push_back(static_cast<float>((i * 31) % 11), index);
+    }
+    fs.end_ns_extent();
+
+    auto expected = fs;
+    expected.sort(parse_mask);
+    VW::unique_features(expected);
+
+    VW::unique_sort_features(parse_mask, ex);
+
+    EXPECT_TRUE(ex.sorted);
+    ASSERT_EQ(fs.size(), expected.size());
+    for (size_t i = 0; i < fs.size(); ++i)
+    {
+      EXPECT_EQ(fs.indices[i] & parse_mask, expected.indices[i] & parse_mask);
+      EXPECT_FLOAT_EQ(fs.values[i], expected.values[i]);
+    }
+    float sum_feat_sq = 0.f;
+    for (auto value : fs.values) { sum_feat_sq += value * value; }
+    EXPECT_FLOAT_EQ(fs.sum_feat_sq, sum_feat_sq);
+    EXPECT_THAT(fs.namespace_extents, ContainerEq(std::vector<VW::namespace_extent>{{0, fs.size(), 1}}));
+  }
+}
+
 TEST(FeatureGroup, IterateExtentsTest)
 {
   auto vw = VW::initialize(vwtest::make_args("--quiet"));
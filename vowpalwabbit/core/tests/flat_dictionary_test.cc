@@ -0,0 +1,154 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/flat_dictionary.h"
+
+#include "vw/core/constant.h"
+#include "vw/core/example.h"
+#include "vw/core/vw.h"
+#include "vw/test_common/test_common.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace
+{
+std::string write_text_dictionary()
+{
+  const std::string file_name = "flat_dictionary_test.txt";
+  std::ofstream out(file_name);
+  for (int i = 0; i < 100; ++i) { out << "word" << i << " f" << i << ":" << i * 0.5 << " g" << i % 7 << "\n"; }
+  return file_name;
+}
+}  // namespace
+
+TEST(FlatDictionary, SaveAndLookUpEveryWord)
+{
+  VW::details::feature_dict dict;
+  for (int i = 0; i < 1000; ++i)
+  {
+    auto fs = VW::make_unique<VW::features>();
+    for (int j = 0; j <= i % 5; ++j) { fs->push_back(static_cast<float>(j + 1), static_cast<uint64_t>(i * 10 + j)); }
+    dict.emplace("w" + std::to_string(i), std::move(fs));
+  }
+
+  const std::string file_name = "flat_dictionary_lookup_test.vwdict";
+  VW::details::flat_dictionary::save(dict, 7, file_name);
+  ASSERT_TRUE(VW::details::flat_dictionary::is_flat_dictionary_file(file_name));
+
+  {
+    auto flat = VW::details::flat_dictionary::load(file_name);
+    EXPECT_EQ(flat->size(), 1000);
+    EXPECT_EQ(flat->hash_seed(), 7);
+    EXPECT_EQ(flat, VW::details::flat_dictionary::load(file_name));
+
+    VW::details::flat_dictionary_entry entry;
+    for (const auto& kv : dict)
+    {
+      ASSERT_TRUE(flat->find(kv.first, entry)) << kv.first;
+      EXPECT_THAT(std::vector<uint64_t>(entry.indices, entry.indices + entry.size),
+          testing::ElementsAreArray(kv.second->indices.begin(), kv.second->indices.end()));
+      EXPECT_THAT(std::vector<float>(entry.values, entry.values + entry.size),
+          testing::ElementsAreArray(kv.second->values.begin(), kv.second->values.end()));
+      EXPECT_FLOAT_EQ(entry.sum_feat_sq, kv.second->sum_feat_sq);
+    }
+    EXPECT_FALSE(flat->find("missing", entry));
+    EXPECT_FALSE(flat->find("w", entry));
+  }
+
+  std::remove(file_name.c_str());
+}
+
+TEST(FlatDictionary, RejectsTruncatedOrCorruptFiles)
+{
+  VW::details::feature_dict dict;
+  for (int i = 0; i < 10; ++i)
+  {
+    auto fs = VW::make_unique<VW::features>();
+    fs->push_back(1.f, static_cast<uint64_t>(i));
+    dict.emplace("w" + std::to_string(i), std::move(fs));
+  }
+  const std::string file_name = "flat_dictionary_corrupt_test.vwdict";
+  VW::details::flat_dictionary::save(dict, 0, file_name);
+
+  std::string contents;
+  {
+    std::ifstream in(file_name, std::ios::binary);
+    contents.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+  }
+  const auto rewrite = [&](const std::string& data)
+  {
+    std::ofstream out(file_name, std::ios::binary | std::ios::trunc);
+    out.write(data.data(), static_cast<std::streamsize>(data.size()));
+  };
+
+  // The 64 byte header holds the number of buckets at offset 24 and the table size at offset 32. It is followed by
+  // the 4 byte bucket displacements, padded to 8 bytes, and by the 32 byte slots.
+  uint64_t num_buckets = 0;
+  uint64_t table_size = 0;
+  std::memcpy(&num_buckets, &contents[24], sizeof(num_buckets));
+  std::memcpy(&table_size, &contents[32], sizeof(table_size));
+  const size_t slots_offset = 64 + (num_buckets * 4 + 7) / 8 * 8;
+
+  // Point the features of an occupied slot past the end of the feature section.
+  std::string corrupt = contents;
+  size_t slot = 0;
+  for (; slot < table_size; ++slot)
+  {
+    uint32_t feature_count = 0;
+    std::memcpy(&feature_count, &corrupt[slots_offset + slot * 32 + 20], sizeof(feature_count));
+    if (feature_count != 0) { break; }
+  }
+  ASSERT_LT(slot, table_size);
+  const uint64_t feature_offset = 1000;
+  std::memcpy(&corrupt[slots_offset + slot * 32 + 8], &feature_offset, sizeof(feature_offset));
+  rewrite(corrupt);
+  EXPECT_THROW(VW::details::flat_dictionary::load(file_name), VW::vw_exception);
+
+  rewrite(contents.substr(0, contents.size() - 1));
+  EXPECT_THROW(VW::details::flat_dictionary::load(file_name), VW::vw_exception);
+
+  std::remove(file_name.c_str());
+}
+
+TEST(FlatDictionary, ExpandsLikeTextDictionary)
+{
+  const auto text_file = write_text_dictionary();
+  const auto flat_file = text_file + ".vwdict";
+
+  auto text_vw = VW::initialize(vwtest::make_args(
+      "--quiet", "--no_stdin", "--dictionary", "a:" + text_file, "--save_flat_dictionaries", "--dictionary_path", "."));
+  ASSERT_TRUE(VW::details::flat_dictionary::is_flat_dictionary_file(flat_file));
+  auto flat_vw = VW::initialize(
+      vwtest::make_args("--quiet", "--no_stdin", "--dictionary", "a:" + flat_file, "--dictionary_path", "."));
+  EXPECT_TRUE(flat_vw->namespace_dictionaries['a'].empty());
+  ASSERT_EQ(flat_vw->namespace_flat_dictionaries['a'].size(), 1);
+
+  const char* line = "1 |a word3 other word42 word3";
+  auto* text_ex = VW::read_example(*text_vw, line);
+  auto* flat_ex = VW::read_example(*flat_vw, line);
+
+  const auto& text_fs = text_ex->feature_space[VW::details::DICTIONARY_NAMESPACE];
+  const auto& flat_fs = flat_ex->feature_space[VW::details::DICTIONARY_NAMESPACE];
+  EXPECT_EQ(text_fs.size(), 6);
+  EXPECT_THAT(flat_fs.indices, testing::ElementsAreArray(text_fs.indices.begin(), text_fs.indices.end()));
+  EXPECT_THAT(flat_fs.values, testing::ElementsAreArray(text_fs.values.begin(), text_fs.values.end()));
+  EXPECT_FLOAT_EQ(flat_fs.sum_feat_sq, text_fs.sum_feat_sq);
+  EXPECT_EQ(flat_fs.namespace_extents, text_fs.namespace_extents);
+
+  VW::finish_example(*text_vw, *text_ex);
+  VW::finish_example(*flat_vw, *flat_ex);
+
+  EXPECT_THROW(VW::initialize(vwtest::make_args("--quiet", "--no_stdin", "--hash_seed", "5", "--dictionary",
+                   "a:" + flat_file, "--dictionary_path", ".")),
+      VW::vw_exception);
+
+  std::remove(flat_file.c_str());
+  std::remove(text_file.c_str());
+}
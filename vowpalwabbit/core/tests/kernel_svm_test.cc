@@ -0,0 +1,100 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/metric_sink.h"
+#include "vw/core/vw.h"
+#include "vw/test_common/test_common.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr uint64_t CACHE_SIZE = 2000;
+
+// Labels do not follow the features, so most examples end up as support vectors.
+std::vector<float> train_ksvm(
+    std::unique_ptr<VW::workspace>& vw, int num_examples, const std::function<void()>& after_learn = [] {})
+{
+  std::vector<float> predictions;
+  for (int i = 0; i < num_examples; i++)
+  {
+    std::string line = std::string((i * 7919) % 13 < 6 ? "1" : "-1") + " | a" + std::to_string(i % 13) + ":" +
+        std::to_string(1 + i % 4) + " b" + std::to_string(i % 17) + " c" + std::to_string(i % 7);
+    auto* ex = VW::read_example(*vw, line);
+    vw->learn(*ex);
+    predictions.push_back(ex->pred.scalar);
+    vw->finish_example(*ex);
+    after_learn();
+  }
+  return predictions;
+}
+
+std::vector<char> save_model(VW::workspace& vw)
+{
+  auto backing_vector = std::make_shared<std::vector<char>>();
+  VW::io_buf io_writer;
+  io_writer.add_file(VW::io::create_vector_writer(backing_vector));
+  VW::save_predictor(vw, io_writer);
+  io_writer.flush();
+  return *backing_vector;
+}
+}  // namespace
+
+TEST(KernelSvm, ThreadedKernelRowsMatchSerial)
+{
+  const std::string metrics_file = ::testing::TempDir() + "ksvm_threads_metrics.json";
+  auto serial = VW::initialize(vwtest::make_args("--quiet", "--ksvm", "--kernel", "rbf", "--reprocess", "2"));
+  auto threaded = VW::initialize(vwtest::make_args("--quiet", "--ksvm", "--kernel", "rbf", "--reprocess", "2",
+      "--ksvm_threads", "3", "--extra_metrics", metrics_file));
+
+  auto serial_predictions = train_ksvm(serial, 600);
+  auto threaded_predictions = train_ksvm(threaded, 600);
+  EXPECT_THAT(threaded_predictions, testing::Pointwise(testing::FloatEq(), serial_predictions));
+  EXPECT_EQ(save_model(*threaded), save_model(*serial));
+
+  // Rows are only split once they need at least two tasks worth of new kernel values.
+  auto metrics = threaded->global_metrics.collect_metrics(threaded->l);
+  EXPECT_GT(metrics.get_uint("ksvm_num_support"), 256);
+  EXPECT_GT(metrics.get_uint("ksvm_threaded_kernel_rows"), 0);
+
+  std::remove(metrics_file.c_str());
+}
+
+TEST(KernelSvm, BoundedCacheEvictsRows)
+{
+  const std::string metrics_file = ::testing::TempDir() + "ksvm_metrics.json";
+  auto unbounded = VW::initialize(vwtest::make_args("--quiet", "--ksvm", "--extra_metrics", metrics_file));
+  auto bounded = VW::initialize(vwtest::make_args("--quiet", "--ksvm", "--ksvm_cache_size",
+      std::to_string(CACHE_SIZE), "--extra_metrics", metrics_file));
+
+  // The cache size also limits which support vectors are moved to the front, so the two runs need not learn the same
+  // model. Only the cache itself is compared.
+  train_ksvm(unbounded, 300);
+  uint64_t max_cached = 0;
+  train_ksvm(bounded, 300,
+      [&bounded, &max_cached]
+      {
+        const auto cached = bounded->global_metrics.collect_metrics(bounded->l).get_uint("ksvm_cached_kernels");
+        EXPECT_LE(cached, CACHE_SIZE);
+        max_cached = std::max(max_cached, cached);
+      });
+
+  auto unbounded_metrics = unbounded->global_metrics.collect_metrics(unbounded->l);
+  auto bounded_metrics = bounded->global_metrics.collect_metrics(bounded->l);
+  // Without the bound the same data caches more than the bounded run may hold.
+  EXPECT_GT(unbounded_metrics.get_uint("ksvm_cached_kernels"), CACHE_SIZE);
+  EXPECT_GT(max_cached, CACHE_SIZE / 2);
+  // Evicted rows are computed again when they are next used.
+  EXPECT_GT(bounded_metrics.get_uint("ksvm_kernel_evals"), unbounded_metrics.get_uint("ksvm_kernel_evals"));
+
+  std::remove(metrics_file.c_str());
+}
@@ -0,0 +1,116 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "reductions/details/lda/expdigammify_simd.h"
+#include "vw/core/shared_data.h"
+#include "vw/core/vw.h"
+#include "vw/test_common/test_common.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace
+{
+std::unique_ptr<VW::workspace> train_lda(const std::string& lda_threads)
+{
+  auto vw = VW::initialize(vwtest::make_args(
+      "--quiet", "--lda", "7", "--minibatch", "4", "--lda_threads", lda_threads, "-b", "8", "--random_seed", "3"));
+
+  for (int i = 0; i < 32; i++)
+  {
+    std::string line = " |";
+    for (int j = 0; j < 6; j++) { line += " w" + std::to_string((i * 7 + j * 3) % 23) + ":" + std::to_string(j + 1); }
+    auto* ex = VW::read_example(*vw, line);
+    vw->learn(*ex);
+    vw->finish_example(*ex);
+  }
+  return vw;
+}
+}  // namespace
+
+TEST(Lda, ThreadedEStepMatchesSerial)
+{
+  auto serial = train_lda("0");
+  auto threaded = train_lda("3");
+
+  EXPECT_FLOAT_EQ(serial->sd->sum_loss, threaded->sd->sum_loss);
+
+  auto& serial_weights = serial->weights.dense_weights;
+  auto& threaded_weights = threaded->weights.dense_weights;
+  for (uint64_t i = 0; i <= serial_weights.mask(); i++) { EXPECT_FLOAT_EQ(serial_weights[i], threaded_weights[i]); }
+}
+
+TEST(Lda, ThreadedEStepRejectsSparseWeights)
+{
+  EXPECT_THROW(
+      VW::initialize(vwtest::make_args("--quiet", "--lda", "7", "--lda_threads", "3", "--sparse_weights")),
+      VW::vw_exception);
+  EXPECT_NO_THROW(VW::initialize(vwtest::make_args("--quiet", "--lda", "7", "--lda_threads", "1", "--sparse_weights")));
+}
+
+#ifdef BUILD_LDA_WITH_SIMD
+TEST(Lda, ExplicitSimdKernelsMatchExactDigamma)
+{
+  void (*expdigammify)(float*, size_t, float);
+  void (*expdigammify_2)(float*, const float*, size_t, float);
+  if (VW::reductions::lda::cpu_supports_avx512())
+  {
+    expdigammify = VW::reductions::lda::expdigammify_avx512;
+    expdigammify_2 = VW::reductions::lda::expdigammify_2_avx512;
+  }
+  else if (VW::reductions::lda::cpu_supports_avx2())
+  {
+    expdigammify = VW::reductions::lda::expdigammify_avx2;
+    expdigammify_2 = VW::reductions::lda::expdigammify_2_avx2;
+  }
+  else
+  {
+    // Skip this test because of no supported simd implementations.
+    return;
+  }
+
+  // Lengths that exercise the full-width loop, the masked tail and both together.
+  for (size_t num_topics : {1, 5, 8, 16, 19, 37})
+  {
+    std::vector<float> gamma(num_topics);
+    std::vector<float> norm(num_topics);
+    float sum = 0.f;
+    for (size_t k = 0; k < num_topics; k++)
+    {
+      gamma[k] = 0.5f + static_cast<float>(k % 7) * 1.3f;
+      norm[k] = 0.1f * static_cast<float>(k);
+      sum += gamma[k];
+    }
+
+    // Reference values from the identity digamma(x) = digamma(x + 1) - 1 / x and the asymptotic expansion.
+    auto digamma = [](double x)
+    {
+      double result = 0.0;
+      for (; x < 6.0; x += 1.0) { result -= 1.0 / x; }
+      const double inv2 = 1.0 / (x * x);
+      return result + std::log(x) - 0.5 / x - inv2 * (1.0 / 12 - inv2 * (1.0 / 120 - inv2 / 252));
+    };
+
+    auto actual = gamma;
+    expdigammify(actual.data(), num_topics, 1e-10f);
+    for (size_t k = 0; k < num_topics; k++)
+    {
+      const double expected = std::exp(digamma(gamma[k]) - digamma(sum));
+      EXPECT_NEAR(actual[k], expected, expected * 1e-3);
+    }
+
+    actual = gamma;
+    expdigammify_2(actual.data(), norm.data(), num_topics, 1e-10f);
+    for (size_t k = 0; k < num_topics; k++)
+    {
+      const double expected = std::exp(digamma(gamma[k]) - norm[k]);
+      EXPECT_NEAR(actual[k], expected, expected * 1e-3);
+    }
+  }
+}
+#endif
@@ -0,0 +1,88 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/common/vw_exception.h"
+#include "vw/config/options_cli.h"
+#include "vw/core/learner.h"
+#include "vw/core/shared_data.h"
+#include "vw/core/vw.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+TEST(Learner, ParallelDriverMatchesSeparateRuns)
+{
+  const std::string data_file = ::testing::TempDir() + "parallel_driver_test.txt";
+  {
+    std::ofstream out(data_file);
+    for (int i = 0; i < 40; ++i)
+    {
+      out << (i % 3 == 0 ? "1" : "-1") << " |a x" << i % 5 << " y:" << (i % 7) * 0.25 << " |b z" << i % 4 << "\n";
+    }
+  }
+  const std::vector<std::vector<std::string>> configs = {{"-d", data_file},
+      {"--no_stdin", "--sgd", "--learning_rate", "0.1"}, {"--no_stdin", "--loss_function", "logistic"}};
+
+  std::vector<std::unique_ptr<VW::workspace>> workspaces;
+  std::vector<VW::workspace*> all;
+  for (const auto& config : configs)
+  {
+    std::vector<std::string> args = {"--quiet"};
+    args.insert(args.end(), config.begin(), config.end());
+    workspaces.push_back(VW::initialize(VW::make_unique<VW::config::options_cli>(args)));
+    all.push_back(workspaces.back().get());
+  }
+  VW::start_parser(*all.front());
+  VW::LEARNER::generic_driver_parallel(all);
+  VW::end_parser(*all.front());
+
+  for (size_t i = 0; i < configs.size(); ++i)
+  {
+    std::vector<std::string> args = {"--quiet", "-d", data_file};
+    args.insert(args.end(), configs[i].begin() + (i == 0 ? 2 : 1), configs[i].end());
+    auto separate = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+    VW::start_parser(*separate);
+    VW::LEARNER::generic_driver(*separate);
+    VW::end_parser(*separate);
+
+    EXPECT_EQ(all[i]->sd->weighted_labeled_examples, 40.0);
+    EXPECT_EQ(all[i]->sd->weighted_labeled_examples, separate->sd->weighted_labeled_examples);
+    EXPECT_FLOAT_EQ(all[i]->sd->sum_loss, separate->sd->sum_loss);
+  }
+
+  std::remove(data_file.c_str());
+}
+
+TEST(Learner, MultiConfigRejectsDifferentParsing)
+{
+  auto make_workspace = [](std::vector<std::string> args)
+  {
+    args.push_back("--quiet");
+    return VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+  };
+  auto master = make_workspace({});
+
+  auto same_parsing = make_workspace({"--sgd", "--learning_rate", "0.1", "--loss_function", "logistic"});
+  EXPECT_NO_THROW(VW::LEARNER::check_multi_config_compatible(*master, *same_parsing, 1));
+
+  const std::vector<std::vector<std::string>> different_parsing = {{"-b", "20"}, {"--hash", "all"}, {"--chain_hash"},
+      {"--sort_features"}, {"--holdout_period", "5"}, {"--holdout_after", "100"}, {"--ngram", "a2"},
+      {"--affix", "+2a"}};
+  for (const auto& args : different_parsing)
+  {
+    auto other = make_workspace(args);
+    EXPECT_THROW(VW::LEARNER::check_multi_config_compatible(*master, *other, 1), VW::vw_exception) << args[0];
+  }
+
+  // A single pass has no holdout set unless --holdout_after is given, so --holdout_off only matters next to it.
+  auto holdout_master = make_workspace({"--holdout_after", "100"});
+  auto holdout_off = make_workspace({"--holdout_after", "100", "--holdout_off"});
+  EXPECT_THROW(VW::LEARNER::check_multi_config_compatible(*holdout_master, *holdout_off, 1), VW::vw_exception);
+}
@@ -13,6 +13,12 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
 TEST(Merge, AddSubtractModelDelta)
 {
   auto vw_base = VW::initialize(vwtest::make_args("--quiet"));
@@ -384,4 +390,84 @@ TEST(Merge, SerializeDeserializeDelta)
       deserialized_delta->unsafe_get_workspace_ptr()->sd->example_number);
   EXPECT_FLOAT_EQ(delta.unsafe_get_workspace_ptr()->sd->total_features,
       deserialized_delta->unsafe_get_workspace_ptr()->sd->total_features);
-}
\ No newline at end of file
+}
+namespace
+{
+// Trains on (model + 1) * 10 examples whose features are spread over the whole weight vector.
+void train_distinct_examples(VW::workspace& vw, size_t model)
+{
+  for (size_t i = 0; i < (model + 1) * 10; ++i)
+  {
+    std::string line = (i % 2 == 0 ? "1 |" : "-1 |");
+    for (size_t j = 0; j < 50; ++j) { line += " m" + std::to_string(model) + "_" + std::to_string(i * 50 + j); }
+    auto* ex = VW::read_example(vw, line);
+    vw.learn(*ex);
+    vw.finish_example(*ex);
+  }
+}
+}  // namespace
+
+TEST(Merge, DenseMergeInRangesMatchesSerialMerge)
+{
+  // 2^18 dense weights are merged in two to four ranges, depending on the number of hardware threads.
+  std::vector<std::unique_ptr<VW::workspace>> models;
+  std::vector<const VW::workspace*> workspaces;
+  for (size_t model = 0; model < 3; ++model)
+  {
+    models.push_back(VW::initialize(vwtest::make_args("--quiet", "--sgd", "-b", "18")));
+    train_distinct_examples(*models.back(), model);
+    workspaces.push_back(models.back().get());
+  }
+  auto merged = VW::merge_models(nullptr, workspaces);
+
+  // The serial merge: every weight is the example count weighted sum of the sources, added in model order.
+  float total_examples = 0.f;
+  for (const auto* ws : workspaces) { total_examples += static_cast<float>(ws->sd->weighted_labeled_examples); }
+  const size_t length = static_cast<size_t>(1) << 18;
+  size_t mismatches = 0;
+  size_t nonzero_in_last_quarter = 0;
+  for (size_t i = 0; i < length; i++)
+  {
+    float expected = 0.f;
+    for (const auto* ws : workspaces)
+    {
+      const float weighting = static_cast<float>(ws->sd->weighted_labeled_examples) / total_examples;
+      expected += ws->weights.dense_weights.strided_index(i) * weighting;
+    }
+    const float weight = merged->weights.dense_weights.strided_index(i);
+    if (weight != expected) { ++mismatches; }
+    if (i >= length / 4 * 3 && weight != 0.f) { ++nonzero_in_last_quarter; }
+  }
+  EXPECT_EQ(mismatches, 0);
+  EXPECT_GT(nonzero_in_last_quarter, 0);
+}
+
+TEST(Merge, MergingDeltasOneAtATimeMatchesMergingAllAtOnce)
+{
+  auto base = VW::initialize(vwtest::make_args("--quiet", "--sgd"));
+  train_distinct_examples(*base, 0);
+
+  std::vector<VW::model_delta> deltas;
+  for (size_t model = 1; model < 4; ++model)
+  {
+    auto vw = VW::initialize(vwtest::make_args("--quiet", "--sgd"));
+    train_distinct_examples(*vw, 0);
+    train_distinct_examples(*vw, model);
+    deltas.emplace_back(*vw - *base);
+  }
+
+  auto all_at_once = *base + VW::merge_deltas({&deltas[0], &deltas[1], &deltas[2]});
+  auto running = VW::merge_deltas({&deltas[0], &deltas[1]});
+  running = VW::merge_deltas({&running, &deltas[2]});
+  auto one_at_a_time = *base + running;
+
+  EXPECT_FLOAT_EQ(one_at_a_time->sd->weighted_labeled_examples, all_at_once->sd->weighted_labeled_examples);
+  const size_t length = static_cast<size_t>(1) << base->num_bits;
+  for (size_t i = 0; i < length; i++)
+  {
+    // The intermediate merge is rounded to float, so the weights agree to a few ulps rather than exactly.
+    const float expected = all_at_once->weights.dense_weights.strided_index(i);
+    EXPECT_NEAR(one_at_a_time->weights.dense_weights.strided_index(i), expected,
+        1e-5f * std::max(1.f, std::abs(expected)));
+  }
+}
@@ -0,0 +1,101 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/hot_path_profile.h"
+#include "vw/core/learner.h"
+#include "vw/core/metric_sink.h"
+#include "vw/core/vw.h"
+#include "vw/test_common/test_common.h"
+
+#include <fmt/format.h>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+TEST(Metrics, ProfileHotPathCountsEveryStage)
+{
+  const std::string data_file = ::testing::TempDir() + "profile_hot_path_test.txt";
+  {
+    std::ofstream out(data_file);
+    for (int i = 0; i < 40; ++i) { out << (i % 3 == 0 ? "1" : "-1") << " |a x" << i % 5 << " |b z" << i % 4 << "\n"; }
+  }
+  const std::string metrics_file = ::testing::TempDir() + "profile_metrics.json";
+  auto vw = VW::initialize(vwtest::make_args(
+      "--quiet", "--no_stdin", "-d", data_file, "--extra_metrics", metrics_file, "--profile_hot_path"));
+  VW::start_parser(*vw);
+  VW::LEARNER::generic_driver(*vw);
+  VW::end_parser(*vw);
+
+  const auto metrics = vw->global_metrics.collect_metrics(vw->l);
+  const auto profile = metrics.get_metric_sink("hot_path_profile");
+  EXPECT_EQ(profile.get_uint("parse_calls"), 41);
+  EXPECT_EQ(profile.get_uint("setup_example_calls"), 40);
+  EXPECT_EQ(profile.get_uint("finish_example_calls"), 40);
+
+  // Reductions are keyed by their depth below the first profiled learner.
+  const auto* l = vw->l;
+  while (l->get_profile() == nullptr) { l = l->get_learn_base(); }
+  size_t depth = 0;
+  for (; l->get_learn_base() != nullptr; l = l->get_learn_base()) { ++depth; }
+  const auto base = profile.get_metric_sink("reductions").get_metric_sink(fmt::format("{}_{}", depth, l->get_name()));
+  EXPECT_EQ(base.get_uint("learn_calls"), 40);
+  EXPECT_GT(base.get_uint("self_ticks"), 0);
+
+  std::remove(data_file.c_str());
+  std::remove(metrics_file.c_str());
+}
+
+TEST(Metrics, ProfileHotPathCountsMultipredict)
+{
+  const std::string metrics_file = ::testing::TempDir() + "profile_multipredict_metrics.json";
+  auto vw = VW::initialize(
+      vwtest::make_args("--quiet", "--oaa", "3", "--extra_metrics", metrics_file, "--profile_hot_path"));
+  for (int i = 0; i < 4; ++i)
+  {
+    auto* ex = VW::read_example(*vw, "|a x1");
+    vw->predict(*ex);
+    vw->finish_example(*ex);
+  }
+
+  // oaa scores all its classes with one multipredict call into the scorer when predicting.
+  const auto* scorer = vw->l->get_learner_by_name_prefix("scorer");
+  ASSERT_NE(scorer->get_profile(), nullptr);
+  EXPECT_EQ(scorer->get_profile()->multipredict.calls, 4);
+  EXPECT_EQ(scorer->get_profile()->predict.calls, 0);
+
+  const auto metrics = vw->global_metrics.collect_metrics(vw->l);
+  const auto reductions = metrics.get_metric_sink("hot_path_profile").get_metric_sink("reductions");
+  size_t depth = 0;
+  for (const auto* l = vw->l; l != scorer; l = l->get_learn_base())
+  {
+    if (l->get_profile() != nullptr) { ++depth; }
+  }
+  const auto scorer_metrics = reductions.get_metric_sink(fmt::format("{}_{}", depth, scorer->get_name()));
+  EXPECT_EQ(scorer_metrics.get_uint("multipredict_calls"), 4);
+  EXPECT_GT(scorer_metrics.get_uint("multipredict_ticks"), 0);
+
+  std::remove(metrics_file.c_str());
+}
+
+TEST(Metrics, ProfileScopeTimesOneCallPerSampleInterval)
+{
+  VW::details::profile_counter counter;
+  { VW::details::profile_scope first(&counter); }
+  const uint64_t first_ticks = counter.ticks;
+  EXPECT_EQ(first_ticks % VW::details::PROFILE_SAMPLE_INTERVAL, 0);
+
+  for (uint64_t i = 1; i < VW::details::PROFILE_SAMPLE_INTERVAL; ++i) { VW::details::profile_scope untimed(&counter); }
+  EXPECT_EQ(counter.calls, VW::details::PROFILE_SAMPLE_INTERVAL);
+  EXPECT_EQ(counter.ticks, first_ticks);
+
+  { VW::details::profile_scope timed(&counter); }
+  EXPECT_EQ(counter.calls, VW::details::PROFILE_SAMPLE_INTERVAL + 1);
+  EXPECT_GE(counter.ticks, first_ticks);
+  EXPECT_EQ(counter.ticks % VW::details::PROFILE_SAMPLE_INTERVAL, 0);
+
+  VW::details::profile_scope disabled(nullptr);
+}
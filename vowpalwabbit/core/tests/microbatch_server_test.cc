@@ -0,0 +1,167 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/microbatch_server.h"
+
+#include "vw/common/vw_exception.h"
+#include "vw/core/learner.h"
+#include "vw/core/vw.h"
+#include "vw/test_common/test_common.h"
+#include "vw/text_parser/parse_example_text.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <future>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+std::string regression_example(size_t i, bool labeled)
+{
+  std::string line = labeled ? std::to_string(i % 3 == 0 ? 1 : -1) : std::string{};
+  line += " |a x:" + std::to_string(i % 7) + " y" + std::to_string(i % 5) + " |b z:" + std::to_string(0.5 * (i % 4));
+  return line;
+}
+
+// Load generator: num_clients threads submit their share of requests as fast as they can and keep the futures by
+// request index.
+std::vector<std::future<VW::polyprediction>> run_load(
+    VW::microbatch_server& server, const std::vector<std::string>& requests, size_t num_clients)
+{
+  std::vector<std::future<VW::polyprediction>> answers(requests.size());
+  std::vector<std::thread> clients;
+  for (size_t c = 0; c < num_clients; c++)
+  {
+    clients.emplace_back(
+        [&, c]
+        {
+          for (size_t i = c; i < requests.size(); i += num_clients) { answers[i] = server.predict(requests[i]); }
+        });
+  }
+  for (auto& client : clients) { client.join(); }
+  return answers;
+}
+}  // namespace
+
+TEST(MicrobatchServer, ConcurrentPredictionsMatchSequential)
+{
+  auto vw = VW::initialize(vwtest::make_args("--quiet", "-q", "ab"));
+  for (size_t i = 0; i < 100; i++)
+  {
+    auto& ex = *VW::read_example(*vw, regression_example(i, true));
+    vw->learn(ex);
+    vw->finish_example(ex);
+  }
+
+  std::vector<std::string> requests;
+  std::vector<float> expected;
+  for (size_t i = 0; i < 400; i++)
+  {
+    requests.push_back(regression_example(i * 13, false));
+    auto& ex = *VW::read_example(*vw, requests.back());
+    vw->predict(ex);
+    expected.push_back(ex.pred.scalar);
+    vw->finish_example(ex);
+  }
+
+  VW::microbatch_server_options options;
+  options.max_batch_size = 16;
+  options.latency_budget = std::chrono::microseconds(200);
+  VW::microbatch_server server(*vw, options);
+  auto answers = run_load(server, requests, 8);
+  for (size_t i = 0; i < answers.size(); i++) { EXPECT_FLOAT_EQ(answers[i].get().scalar, expected[i]); }
+
+  const auto stats = server.stats();
+  EXPECT_EQ(stats.requests, 400);
+  EXPECT_EQ(stats.batch_sizes.size(), 17);
+  EXPECT_EQ(stats.batch_sizes[0], 0);
+  uint64_t batched_requests = 0;
+  for (size_t n = 0; n < stats.batch_sizes.size(); n++) { batched_requests += n * stats.batch_sizes[n]; }
+  EXPECT_EQ(batched_requests, 400);
+  EXPECT_EQ(std::accumulate(stats.batch_sizes.begin(), stats.batch_sizes.end(), uint64_t{0}), stats.batches);
+  EXPECT_EQ(std::accumulate(stats.queue_depths.begin(), stats.queue_depths.end(), uint64_t{0}), stats.batches);
+  EXPECT_GT(stats.p50_latency.count(), 0);
+  EXPECT_GE(stats.p99_latency, stats.p50_latency);
+}
+
+TEST(MicrobatchServer, LearnsInSubmissionOrder)
+{
+  auto served = VW::initialize(vwtest::make_args("--quiet", "--sgd", "--learning_rate", "0.1"));
+  auto sequential = VW::initialize(vwtest::make_args("--quiet", "--sgd", "--learning_rate", "0.1"));
+
+  std::vector<std::future<VW::polyprediction>> answers;
+  {
+    VW::microbatch_server_options options;
+    options.max_batch_size = 8;
+    VW::microbatch_server server(*served, options);
+    for (size_t i = 0; i < 50; i++) { answers.push_back(server.learn(regression_example(i, true))); }
+  }
+
+  for (size_t i = 0; i < answers.size(); i++)
+  {
+    auto& ex = *VW::read_example(*sequential, regression_example(i, true));
+    sequential->learn(ex);
+    EXPECT_FLOAT_EQ(answers[i].get().scalar, ex.pred.scalar);
+    sequential->finish_example(ex);
+  }
+}
+
+TEST(MicrobatchServer, AnswersMultilineRequests)
+{
+  auto vw = VW::initialize(vwtest::make_args("--quiet", "--cb_explore_adf", "--epsilon", "0.2"));
+  const std::vector<std::string> requests = {
+      "shared | s_1 s_2\n0:1.0:0.5 | a_1 b_1\n| a_2 b_2\n| a_3 b_3",
+      "shared | s_3\n| a_1\n0:0.0:0.5 | a_2 b_2",
+      "shared | s_1\n| a_1 b_1\n| a_2\n| a_3\n| a_4",
+  };
+
+  std::vector<VW::action_scores> expected;
+  {
+    auto reference = VW::initialize(vwtest::make_args("--quiet", "--cb_explore_adf", "--epsilon", "0.2"));
+    for (const auto& request : requests)
+    {
+      VW::multi_ex examples;
+      VW::parsers::text::read_lines(reference.get(), request, examples);
+      VW::setup_examples(*reference, examples);
+      reference->learn(examples);
+      expected.push_back(examples[0]->pred.a_s);
+      reference->finish_example(examples);
+    }
+  }
+
+  VW::microbatch_server server(*vw);
+  std::vector<std::future<VW::polyprediction>> answers;
+  for (const auto& request : requests) { answers.push_back(server.learn(request)); }
+  for (size_t i = 0; i < answers.size(); i++)
+  {
+    const auto prediction = answers[i].get();
+    ASSERT_EQ(prediction.a_s.size(), expected[i].size());
+    for (size_t j = 0; j < expected[i].size(); j++)
+    {
+      EXPECT_EQ(prediction.a_s[j].action, expected[i][j].action);
+      EXPECT_FLOAT_EQ(prediction.a_s[j].score, expected[i][j].score);
+    }
+  }
+}
+
+TEST(MicrobatchServer, FailedRequestDoesNotAffectItsBatch)
+{
+  auto vw = VW::initialize(vwtest::make_args("--quiet"));
+  VW::microbatch_server_options options;
+  options.latency_budget = std::chrono::milliseconds(50);
+  VW::microbatch_server server(*vw, options);
+
+  auto first = server.predict("| a b");
+  auto failed = server.predict("| a\n| b");
+  auto last = server.predict("| c");
+
+  EXPECT_FLOAT_EQ(first.get().scalar, 0.f);
+  EXPECT_THROW(failed.get(), VW::vw_exception);
+  EXPECT_FLOAT_EQ(last.get().scalar, 0.f);
+  EXPECT_EQ(server.stats().requests, 3);
+}
@@ -2,15 +2,21 @@
 // individual contributors. All rights reserved. Released under a BSD (revised)
 // license as described in the file LICENSE.
 
+#include "vw/config/options_cli.h"
+#include "vw/core/learner.h"
 #include "vw/core/parse_args.h"
 #include "vw/core/parse_example.h"
 #include "vw/core/parse_primitives.h"
+#include "vw/core/shared_data.h"
 #include "vw/core/vw.h"
 #include "vw/test_common/test_common.h"
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cstdio>
+#include <fstream>
+
 TEST(Parser, DecodeInlineHexTest)
 {
   auto nl = VW::io::create_null_logger();
@@ -58,4 +64,93 @@ TEST(Parser, TrimWhitespaceTest)
   EXPECT_TRUE("a\nb     c" == VW::trim_whitespace(std::string("              a\nb     c               ")));
   EXPECT_TRUE("a\nb     \tc" == VW::trim_whitespace(std::string("     \t         a\nb     \tc        \t\t       ")));
   EXPECT_TRUE("" == VW::trim_whitespace(std::string("     \t                 \t\t       ")));
-}
\ No newline at end of file
+}
+
+namespace
+{
+VW::shared_data run_passes_from_file(const std::string& data_file, std::vector<std::string> extra_args)
+{
+  std::vector<std::string> args = {"--quiet", "--no_stdin", "--passes", "4", "-d", data_file};
+  args.insert(args.end(), extra_args.begin(), extra_args.end());
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+  VW::start_parser(*vw);
+  VW::LEARNER::generic_driver(*vw);
+  VW::end_parser(*vw);
+  return *vw->sd;
+}
+
+std::string write_passes_data_file()
+{
+  const std::string data_file = ::testing::TempDir() + "in_memory_passes_test.txt";
+  std::ofstream out(data_file);
+  // Importance weights and tags go through the replayed label and tag records.
+  for (int i = 0; i < 40; ++i)
+  {
+    out << (i % 3 == 0 ? "1 " : "-1 ") << 1 + i % 2 << " 'ex" << i << " |a x" << i % 5 << " y:" << (i % 7) * 0.25
+        << " |b z" << i % 4 << "\n";
+  }
+  return data_file;
+}
+}  // namespace
+
+TEST(Parser, InMemoryPassesMatchCachedPasses)
+{
+  const auto data_file = write_passes_data_file();
+  const std::string cache_file = data_file + ".cache";
+
+  const auto cached = run_passes_from_file(data_file, {"--cache_file", cache_file, "-k"});
+  const auto in_memory = run_passes_from_file(data_file, {"--in_memory_passes"});
+
+  EXPECT_EQ(in_memory.weighted_labeled_examples, cached.weighted_labeled_examples);
+  EXPECT_FLOAT_EQ(in_memory.sum_loss, cached.sum_loss);
+  EXPECT_FLOAT_EQ(in_memory.holdout_sum_loss, cached.holdout_sum_loss);
+  EXPECT_GT(in_memory.holdout_sum_loss, 0.0);
+
+  std::remove(cache_file.c_str());
+  std::remove(data_file.c_str());
+}
+
+TEST(Parser, InMemoryPassesMatchCachedPassesForMultilineExamples)
+{
+  const std::string data_file = ::testing::TempDir() + "in_memory_passes_ccb_test.txt";
+  {
+    std::ofstream out(data_file);
+    for (int i = 0; i < 30; ++i)
+    {
+      out << "ccb shared |s u" << i % 4 << "\n";
+      out << "ccb action |a x\nccb action |a y" << i % 3 << "\n";
+      out << "ccb slot " << i % 2 << ":" << (i % 5) * 0.25 << ":0.5 |\n\n";
+    }
+  }
+  const std::string cache_file = data_file + ".cache";
+
+  const auto cached = run_passes_from_file(data_file, {"--ccb_explore_adf", "--cache_file", cache_file, "-k"});
+  const auto in_memory = run_passes_from_file(data_file, {"--ccb_explore_adf", "--in_memory_passes"});
+
+  EXPECT_EQ(in_memory.weighted_labeled_examples, cached.weighted_labeled_examples);
+  EXPECT_FLOAT_EQ(in_memory.sum_loss, cached.sum_loss);
+  EXPECT_FLOAT_EQ(in_memory.holdout_sum_loss, cached.holdout_sum_loss);
+
+  std::remove(cache_file.c_str());
+  std::remove(data_file.c_str());
+}
+
+TEST(Parser, InMemoryPassesShuffleReplaysEveryExample)
+{
+  const auto data_file = write_passes_data_file();
+
+  const auto ordered = run_passes_from_file(data_file, {"--in_memory_passes", "--holdout_off"});
+  const auto shuffled = run_passes_from_file(data_file, {"--in_memory_passes", "--in_memory_shuffle", "--holdout_off"});
+
+  EXPECT_EQ(ordered.weighted_labeled_examples, 240.0);
+  EXPECT_EQ(shuffled.weighted_labeled_examples, 240.0);
+  EXPECT_NE(shuffled.sum_loss, ordered.sum_loss);
+
+  std::remove(data_file.c_str());
+}
+
+TEST(Parser, MultiplePassesNeedCacheOrInMemoryPasses)
+{
+  EXPECT_THROW(VW::initialize(vwtest::make_args("--quiet", "--passes", "2", "-d", "unused.txt")), VW::vw_exception);
+  EXPECT_THROW(VW::initialize(vwtest::make_args("--quiet", "--in_memory_shuffle")), VW::vw_exception);
+}
@@ -0,0 +1,71 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/vw.h"
+#include "vw/test_common/test_common.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+std::vector<std::vector<uint32_t>> train_and_predict_top_k(const std::string& beam_width)
+{
+  auto vw = VW::initialize(vwtest::make_args("--quiet", "--plt", "23", "--kary_tree", "3", "--loss_function",
+      "logistic", "--top_k", "4", "--top_k_beam_width", beam_width, "-l", "5", "--random_seed", "7"));
+
+  std::vector<std::string> lines;
+  for (int i = 0; i < 60; i++)
+  {
+    lines.push_back(std::to_string(i % 23) + "," + std::to_string((i * 5) % 23) + " | f" + std::to_string(i % 11) +
+        " g" + std::to_string(i % 6) + ":0.5");
+  }
+  for (int pass = 0; pass < 3; pass++)
+  {
+    for (const auto& line : lines)
+    {
+      auto* ex = VW::read_example(*vw, line);
+      vw->learn(*ex);
+      vw->finish_example(*ex);
+    }
+  }
+
+  std::vector<std::vector<uint32_t>> predictions;
+  for (int i = 0; i < 11; i++)
+  {
+    auto* ex = VW::read_example(*vw, " | f" + std::to_string(i) + " g" + std::to_string(i % 6) + ":0.5");
+    vw->predict(*ex);
+    predictions.emplace_back(ex->pred.multilabels.label_v.begin(), ex->pred.multilabels.label_v.end());
+    vw->finish_example(*ex);
+  }
+  return predictions;
+}
+}  // namespace
+
+TEST(Plt, WideBeamMatchesExactTopK)
+{
+  // With a beam wider than any level of the tree the beam search is exhaustive.
+  auto exact = train_and_predict_top_k("0");
+  auto beam = train_and_predict_top_k("32");
+
+  ASSERT_EQ(exact.size(), beam.size());
+  for (size_t i = 0; i < exact.size(); i++)
+  {
+    EXPECT_EQ(exact[i].size(), 4);
+    EXPECT_THAT(beam[i], testing::ElementsAreArray(exact[i]));
+  }
+}
+
+TEST(Plt, NarrowBeamReturnsTopK)
+{
+  auto beam = train_and_predict_top_k("4");
+  for (const auto& labels : beam)
+  {
+    EXPECT_EQ(labels.size(), 4);
+    for (auto label : labels) { EXPECT_LT(label, 23); }
+  }
+}
@@ -2,12 +2,20 @@
 // individual contributors. All rights reserved. Released under a BSD (revised)
 // license as described in the file LICENSE.
 
+#include "vw/core/learner.h"
+#include "vw/core/reductions/scorer.h"
 #include "vw/core/vw.h"
 #include "vw/test_common/test_common.h"
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
 // Test case validating this issue: https://github.com/VowpalWabbit/vowpal_wabbit/issues/2166
 TEST(Predict, PredictModifyingState)
 {
@@ -43,3 +51,111 @@ TEST(Predict, PredictModifyingState)
 
   EXPECT_FLOAT_EQ(prediction_one, prediction_two);
 }
+
+TEST(Predict, ScorerGdFastPathMatchesGd)
+{
+  auto vw = VW::initialize(vwtest::make_args("--quiet", "--link", "logistic", "-q", "ab"));
+
+  for (int i = 0; i < 10; ++i)
+  {
+    auto& learn_example = *VW::read_example(*vw, i % 2 == 0 ? "1 |a x:0.5 y |b z:2" : "-1 |a x:-1 |b w");
+    vw->learn(learn_example);
+    vw->finish_example(learn_example);
+  }
+
+  auto* scorer = static_cast<VW::reductions::details::scorer*>(
+      vw->l->get_learner_by_name_prefix("scorer")->get_internal_type_erased_data_pointer_test_use_only());
+  ASSERT_TRUE(scorer->gd_fast_path);
+
+  auto& predict_example = *VW::read_example(*vw, "|a x:0.25 y:3 |b z w:-2");
+  auto* gd = VW::LEARNER::as_singleline(vw->l->get_learner_by_name_prefix("gd"));
+  gd->predict(predict_example);
+  const float gd_partial_prediction = predict_example.partial_prediction;
+  const float gd_prediction = predict_example.pred.scalar;
+  const auto gd_interacted_features = predict_example.num_features_from_interactions;
+
+  vw->predict(predict_example);
+  EXPECT_FLOAT_EQ(predict_example.partial_prediction, gd_partial_prediction);
+  EXPECT_FLOAT_EQ(predict_example.pred.scalar, 1.f / (1.f + std::exp(-gd_prediction)));
+  EXPECT_EQ(predict_example.num_features_from_interactions, gd_interacted_features);
+  vw->finish_example(predict_example);
+}
+
+TEST(Predict, ScorerGdFastPathIsOffForTruncatedGd)
+{
+  auto vw = VW::initialize(vwtest::make_args("--quiet", "--l1", "1e-6"));
+  auto* scorer = static_cast<VW::reductions::details::scorer*>(
+      vw->l->get_learner_by_name_prefix("scorer")->get_internal_type_erased_data_pointer_test_use_only());
+  EXPECT_FALSE(scorer->gd_fast_path);
+}
+
+TEST(Predict, ScorerGdFastPathIsProfiledAsGd)
+{
+  auto vw = VW::initialize(vwtest::make_args("--quiet", "--extra_metrics",
+      ::testing::TempDir() + "scorer_fast_path_metrics.json", "--profile_hot_path"));
+  auto* scorer_learner = vw->l->get_learner_by_name_prefix("scorer");
+  auto* scorer = static_cast<VW::reductions::details::scorer*>(
+      scorer_learner->get_internal_type_erased_data_pointer_test_use_only());
+  ASSERT_TRUE(scorer->gd_fast_path);
+
+  for (int i = 0; i < 5; ++i)
+  {
+    auto& ex = *VW::read_example(*vw, "|a x:0.25 y:3 |b z w:-2");
+    vw->predict(ex);
+    vw->finish_example(ex);
+  }
+
+  const auto* gd = vw->l->get_learner_by_name_prefix("gd");
+  ASSERT_NE(gd->get_profile(), nullptr);
+  EXPECT_EQ(gd->get_profile()->predict.calls, 5);
+  EXPECT_EQ(scorer_learner->get_profile()->predict.calls, 5);
+}
+
+TEST(Predict, InferenceContextsPredictConcurrently)
+{
+  auto model = VW::initialize(vwtest::make_args("--quiet", "--link", "logistic", "-q", "ab"));
+  for (int i = 0; i < 20; ++i)
+  {
+    auto& learn_example = *VW::read_example(*model, i % 3 == 0 ? "1 |a x:0.5 y |b z:2" : "-1 |a x:-1 |b w");
+    model->learn(learn_example);
+    model->finish_example(learn_example);
+  }
+
+  const std::vector<std::string> lines = {"|a x:0.25 y:3 |b z w:-2", "|a y |b z", "|a x:2", "|b w:0.5 z:0.5"};
+  std::vector<float> expected;
+  for (const auto& line : lines)
+  {
+    auto& ex = *VW::read_example(*model, line);
+    model->predict(ex);
+    expected.push_back(ex.pred.scalar);
+    model->finish_example(ex);
+  }
+
+  std::vector<std::unique_ptr<VW::workspace>> contexts;
+  for (size_t i = 0; i < 2; ++i) { contexts.push_back(VW::create_inference_context(*model, {"--quiet"})); }
+  EXPECT_EQ(contexts[0]->weights.dense_weights.first(), model->weights.dense_weights.first());
+
+  std::vector<std::vector<float>> actual(contexts.size());
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < contexts.size(); ++t)
+  {
+    threads.emplace_back(
+        [&contexts, &actual, &lines, t]
+        {
+          auto& context = *contexts[t];
+          for (int round = 0; round < 50; ++round)
+          {
+            for (const auto& line : lines)
+            {
+              auto& ex = *VW::read_example(context, line);
+              context.predict(ex);
+              if (round == 0) { actual[t].push_back(ex.pred.scalar); }
+              context.finish_example(ex);
+            }
+          }
+        });
+  }
+  for (auto& thread : threads) { thread.join(); }
+
+  for (const auto& predictions : actual) { EXPECT_THAT(predictions, testing::Pointwise(testing::FloatEq(), expected)); }
+}
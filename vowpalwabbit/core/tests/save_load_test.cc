@@ -85,3 +85,57 @@ TEST(SaveLoad, SaveResumeBehavesAsIfDatasetConcatenated)
   EXPECT_EQ(vw_all_data_single_run->sd->weighted_examples(), vw_second_half_from_loaded->sd->weighted_examples());
   EXPECT_EQ(vw_all_data_single_run->sd->sum_loss, vw_second_half_from_loaded->sd->sum_loss);
 }
+
+TEST(SaveLoad, SparseWeightsRoundTrip)
+{
+  // With -b 34 strided weight offsets pass 32 bits and the model stores indices as 64 bit values.
+  for (const char* bits : {"18", "34"})
+  {
+    auto vw_save = VW::initialize(vwtest::make_args("--no_stdin", "--quiet", "--sparse_weights", "-b", bits));
+    for (int i = 0; i < 20; i++)
+    {
+      auto* ex = VW::read_example(*vw_save, std::to_string(i % 3) + " |a x" + std::to_string(i) + " y |b z:0.5");
+      vw_save->learn(*ex);
+      vw_save->finish_example(*ex);
+    }
+
+    auto backing_vector = std::make_shared<std::vector<char>>();
+    VW::io_buf io_writer;
+    io_writer.add_file(VW::io::create_vector_writer(backing_vector));
+    VW::save_predictor(*vw_save, io_writer);
+    io_writer.flush();
+
+    auto vw_load = VW::initialize(vwtest::make_args("--no_stdin", "--quiet", "--sparse_weights"),
+        VW::io::create_buffer_view(backing_vector->data(), backing_vector->size()));
+    EXPECT_EQ(vw_load->num_bits, vw_save->num_bits);
+
+    auto& saved = vw_save->weights.sparse_weights;
+    auto& loaded = vw_load->weights.sparse_weights;
+    size_t non_zero = 0;
+    for (auto it = saved.begin(); it != saved.end(); ++it)
+    {
+      if (*it == 0.f) { continue; }
+      non_zero++;
+      EXPECT_FLOAT_EQ(loaded[it.index()], *it);
+    }
+    EXPECT_GT(non_zero, 0);
+    if (vw_save->num_bits > 32)
+    {
+      bool above_32_bits = false;
+      for (auto it = loaded.begin(); it != loaded.end(); ++it) { above_32_bits |= (it.index() >> 32) != 0; }
+      EXPECT_TRUE(above_32_bits);
+    }
+
+    for (int i = 0; i < 5; i++)
+    {
+      const std::string line = " |a x" + std::to_string(i) + " y |b z:0.5";
+      auto* saved_ex = VW::read_example(*vw_save, line);
+      auto* loaded_ex = VW::read_example(*vw_load, line);
+      vw_save->predict(*saved_ex);
+      vw_load->predict(*loaded_ex);
+      EXPECT_FLOAT_EQ(loaded_ex->pred.scalar, saved_ex->pred.scalar);
+      vw_save->finish_example(*saved_ex);
+      vw_load->finish_example(*loaded_ex);
+    }
+  }
+}
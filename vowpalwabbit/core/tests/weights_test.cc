@@ -8,6 +8,8 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <map>
+
 constexpr auto LENGTH = 16;
 constexpr auto STRIDE_SHIFT = 2;
 
@@ -24,4 +26,49 @@ TYPED_TEST(WeightTests, TestDefaultFunctionWeightInitializationStridedIndex)
   auto weight_initializer = [](VW::weight* weights, uint64_t index) { weights[0] = 1.f * index; };
   w.set_default(weight_initializer);
   for (size_t i = 0; i < LENGTH; i++) { EXPECT_FLOAT_EQ(w.strided_index(i), 1.f * (i * w.stride())); }
-}
\ No newline at end of file
+}
+
+TEST(SparseWeights, IteratesTouchedWeights)
+{
+  VW::sparse_parameters w(LENGTH, STRIDE_SHIFT);
+  EXPECT_TRUE(w.begin() == w.end());
+
+  w.strided_index(3) = 3.f;
+  w.strided_index(7) = 7.f;
+  (&w.strided_index(7))[1] = 1.f;
+
+  std::map<uint64_t, float> seen;
+  for (auto it = w.begin(); it != w.end(); ++it) { seen[it.index()] = *it; }
+  EXPECT_THAT(seen, ::testing::ElementsAre(::testing::Pair(3 * w.stride(), 3.f), ::testing::Pair(7 * w.stride(), 7.f)));
+  EXPECT_EQ(w.size(), 2);
+
+  w.set_zero(1);
+  EXPECT_FLOAT_EQ((&w.strided_index(7))[1], 0.f);
+  EXPECT_FLOAT_EQ(w.strided_index(7), 7.f);
+}
+
+TEST(SparseWeights, WeightsStayInPlaceWhenTableGrows)
+{
+  // 40 bits would not fit in memory as dense weights.
+  constexpr uint64_t NUM_BITS = 40;
+  VW::sparse_parameters w(static_cast<uint64_t>(1) << NUM_BITS, STRIDE_SHIFT);
+  w.set_default([](VW::weight* weights, uint64_t index) { weights[1] = static_cast<float>(index % 1000); });
+
+  constexpr uint64_t NUM_WEIGHTS = 20000;
+  constexpr uint64_t STEP = 53737163ULL;
+  VW::weight* first = &w.strided_index(0);
+  for (uint64_t i = 0; i < NUM_WEIGHTS; i++) { w.strided_index(i * STEP) = static_cast<float>(i); }
+
+  EXPECT_EQ(w.size(), NUM_WEIGHTS);
+  EXPECT_EQ(first, &w.strided_index(0));
+  for (uint64_t i = 0; i < NUM_WEIGHTS; i++)
+  {
+    const uint64_t index = (i * STEP) << STRIDE_SHIFT;
+    EXPECT_FLOAT_EQ(w.strided_index(i * STEP), static_cast<float>(i));
+    EXPECT_FLOAT_EQ((&w.strided_index(i * STEP))[1], static_cast<float>(index % 1000));
+  }
+
+  size_t visited = 0;
+  for (auto it = w.begin(); it != w.end(); ++it) { visited++; }
+  EXPECT_EQ(visited, NUM_WEIGHTS);
+}
@@ -34,6 +34,26 @@ public:
 
 int parse_csv_examples(VW::workspace* all, io_buf& buf, VW::multi_ex& examples);
 
+// Everything about a feature column that only depends on the header, computed once per file.
+class csv_column_plan
+{
+public:
+  size_t column = 0;
+  // hash(feature_name, channel_hash), before masking. String values are chained onto it.
+  uint64_t feature_name_hash = 0;
+};
+
+class csv_namespace_plan
+{
+public:
+  // " " for the default namespace.
+  std::string name;
+  unsigned char index = 0;
+  uint64_t channel_hash = 0;
+  float scale = 1.f;
+  std::vector<csv_column_plan> columns;
+};
+
 class csv_parser : public VW::details::input_parser
 {
 public:
@@ -45,6 +65,10 @@ public:
   VW::v_array<size_t> tag_list;
   std::unordered_map<std::string, VW::v_array<size_t>> feature_list;
   std::unordered_map<std::string, float> ns_value;
+  // Compiled from the header and ns_value, in the iteration order of feature_list.
+  std::vector<csv_namespace_plan> column_plan;
+  // Cells of the current line, reused across lines.
+  VW::v_array<VW::string_view> line_cells;
 
   explicit csv_parser(csv_parser_options options) : VW::details::input_parser("csv"), options(std::move(options)) {}
   ~csv_parser() override = default;
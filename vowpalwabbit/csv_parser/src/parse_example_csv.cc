@@ -108,12 +108,12 @@ class CSV_parser
 {
 public:
   CSV_parser(VW::workspace* all, VW::example* ae, VW::string_view csv_line, VW::parsers::csv::csv_parser* parser)
-      : _parser(parser), _all(all), _ae(ae)
+      : _parser(parser), _all(all), _ae(ae), _csv_line(parser->line_cells)
   {
     if (csv_line.empty()) { THROW("Malformed CSV, empty line at " << _parser->line_num << "!"); }
     else
     {
-      _csv_line = split(csv_line, parser->options.csv_separator[0], true);
+      split(csv_line, parser->options.csv_separator[0], _csv_line, true);
       parse_line();
     }
   }
@@ -123,7 +123,7 @@ private:
   VW::parsers::csv::csv_parser* _parser;
   VW::workspace* _all;
   VW::example* _ae;
-  VW::v_array<VW::string_view> _csv_line;
+  VW::v_array<VW::string_view>& _csv_line;
   std::vector<std::string> _token_storage;
   size_t _anon{};
   uint64_t _channel_hash{};
@@ -138,7 +138,8 @@ private:
       if (_parser->options.csv_header.empty()) { parse_header(_csv_line); }
       else
       {
-        VW::v_array<VW::string_view> header_elements = split(_parser->options.csv_header, ',');
+        VW::v_array<VW::string_view> header_elements;
+        split(_parser->options.csv_header, ',', header_elements);
         parse_header(header_elements);
       }
 
@@ -146,6 +147,8 @@ private:
 
       // Store the ns value from CmdLine
       if (_parser->ns_value.empty() && !_parser->options.csv_ns_value.empty()) { parse_ns_value(); }
+
+      compile_column_plan();
     }
 
     if (_csv_line.size() != _parser->header_fn.size())
@@ -158,10 +161,12 @@ private:
 
   inline FORCE_INLINE void parse_ns_value()
   {
-    VW::v_array<VW::string_view> ns_values = split(_parser->options.csv_ns_value, ',', true);
+    VW::v_array<VW::string_view> ns_values;
+    VW::v_array<VW::string_view> pair;
+    split(_parser->options.csv_ns_value, ',', ns_values, true);
     for (size_t i = 0; i < ns_values.size(); i++)
     {
-      VW::v_array<VW::string_view> pair = split(ns_values[i], ':', true);
+      split(ns_values[i], ':', pair, true);
       std::string ns = " ";
       float value = 1.f;
       if (pair.size() != 2 || pair[1].empty())
@@ -197,7 +202,8 @@ private:
 
       // Handle other column names as feature names
       // Seperate the feature name and namespace from the header.
-      VW::v_array<VW::string_view> splitted = split(header_elements[i], '|');
+      VW::v_array<VW::string_view> splitted;
+      split(header_elements[i], '|', splitted);
       VW::string_view feature_name;
       VW::string_view ns;
       if (splitted.size() == 1) { feature_name = header_elements[i]; }
@@ -222,6 +228,42 @@ private:
     }
   }
 
+  // Hash the namespace and feature names once, so that rows only hash string values.
+  inline void compile_column_plan()
+  {
+    _parser->column_plan.clear();
+    for (const auto& f : _parser->feature_list)
+    {
+      csv_namespace_plan ns_plan;
+      if (f.first.empty())
+      {
+        ns_plan.name = " ";
+        ns_plan.channel_hash = _all->hash_seed == 0 ? 0 : VW::uniform_hash("", 0, _all->hash_seed);
+      }
+      else
+      {
+        ns_plan.name = f.first;
+        ns_plan.channel_hash = _all->example_parser->hasher(f.first.data(), f.first.length(), _all->hash_seed);
+      }
+      ns_plan.index = static_cast<unsigned char>(ns_plan.name[0]);
+
+      auto it = _parser->ns_value.find(f.first);
+      if (it != _parser->ns_value.end()) { ns_plan.scale = it->second; }
+
+      ns_plan.columns.reserve(f.second.size());
+      for (const auto column_index : f.second)
+      {
+        const auto& feature_name = _parser->header_fn[column_index];
+        csv_column_plan column;
+        column.column = column_index;
+        column.feature_name_hash =
+            _all->example_parser->hasher(feature_name.data(), feature_name.length(), ns_plan.channel_hash);
+        ns_plan.columns.push_back(column);
+      }
+      _parser->column_plan.push_back(std::move(ns_plan));
+    }
+  }
+
   inline FORCE_INLINE void parse_example()
   {
     _all->example_parser->lbl_parser.default_label(_ae->l);
@@ -259,50 +301,31 @@ private:
   {
     // Mark to check if all the cells in the line is empty
     bool empty_line = true;
-    for (auto& f : _parser->feature_list)
+    for (const auto& ns_plan : _parser->column_plan)
     {
       _anon = 0;
-      VW::string_view ns;
-      bool new_index = false;
-      if (f.first.empty())
-      {
-        ns = " ";
-        _channel_hash = _all->hash_seed == 0 ? 0 : VW::uniform_hash("", 0, _all->hash_seed);
-      }
-      else
-      {
-        ns = f.first;
-        _channel_hash = _all->example_parser->hasher(ns.data(), ns.length(), _all->hash_seed);
-      }
-
-      unsigned char _index = static_cast<unsigned char>(ns[0]);
-      if (_ae->feature_space[_index].size() == 0) { new_index = true; }
+      _channel_hash = ns_plan.channel_hash;
+      auto& fs = _ae->feature_space[ns_plan.index];
+      const bool new_index = fs.size() == 0;
 
-      float _cur_channel_v = 1.f;
-      if (!_parser->ns_value.empty())
+      fs.start_ns_extent(_channel_hash);
+      for (const auto& column : ns_plan.columns)
       {
-        auto it = _parser->ns_value.find(f.first);
-        if (it != _parser->ns_value.end()) { _cur_channel_v = it->second; }
+        empty_line = empty_line && _csv_line[column.column].empty();
+        parse_features(fs, column, ns_plan.scale, ns_plan.name);
       }
-      _ae->feature_space[_index].start_ns_extent(_channel_hash);
+      fs.end_ns_extent();
 
-      for (size_t i = 0; i < f.second.size(); i++)
-      {
-        size_t column_index = f.second[i];
-        empty_line = empty_line && _csv_line[column_index].empty();
-        parse_features(_ae->feature_space[_index], column_index, _cur_channel_v, ns);
-      }
-
-      _ae->feature_space[_index].end_ns_extent();
-      if (new_index && _ae->feature_space[_index].size() > 0) { _ae->indices.emplace_back(_index); }
+      if (new_index && fs.size() > 0) { _ae->indices.emplace_back(ns_plan.index); }
     }
     _ae->is_newline = empty_line;
   }
 
-  inline FORCE_INLINE void parse_features(features& fs, size_t column_index, float cur_channel_v, VW::string_view ns)
+  inline FORCE_INLINE void parse_features(
+      features& fs, const csv_column_plan& column, float cur_channel_v, VW::string_view ns)
   {
-    VW::string_view feature_name = _parser->header_fn[column_index];
-    VW::string_view string_feature_value = _csv_line[column_index];
+    VW::string_view feature_name = _parser->header_fn[column.column];
+    VW::string_view string_feature_value = _csv_line[column.column];
 
     uint64_t word_hash;
     float _v;
@@ -327,16 +350,12 @@ private:
     if (!is_feature_float)
     {
       // chain hash is hash(feature_value, hash(feature_name, namespace_hash)) & parse_mask
-      word_hash = (_all->example_parser->hasher(string_feature_value.data(), string_feature_value.length(),
-                       _all->example_parser->hasher(feature_name.data(), feature_name.length(), _channel_hash)) &
+      word_hash = (_all->example_parser->hasher(
+                       string_feature_value.data(), string_feature_value.length(), column.feature_name_hash) &
           _all->parse_mask);
     }
     // Case where feature value is float and feature name is not empty
-    else if (!feature_name.empty())
-    {
-      word_hash =
-          (_all->example_parser->hasher(feature_name.data(), feature_name.length(), _channel_hash) & _all->parse_mask);
-    }
+    else if (!feature_name.empty()) { word_hash = column.feature_name_hash & _all->parse_mask; }
     // Case where feature value is float and feature name is empty
     else { word_hash = _channel_hash + _anon++; }
 
@@ -355,9 +374,10 @@ private:
     }
   }
 
-  inline FORCE_INLINE VW::v_array<VW::string_view> split(VW::string_view sv, const char ch, bool use_quotes = false)
+  inline FORCE_INLINE void split(
+      VW::string_view sv, const char ch, VW::v_array<VW::string_view>& collections, bool use_quotes = false)
   {
-    VW::v_array<VW::string_view> collections;
+    collections.clear();
     size_t pointer = 0;
     // Trim extra characters that are useless for us to read
     const char* trim_list = "\r\n\xef\xbb\xbf\f\v";
@@ -370,7 +390,7 @@ private:
     if (sv.empty())
     {
       collections.emplace_back();
-      return collections;
+      return;
     }
 
     for (size_t i = 0; i <= sv.length(); i++)
@@ -430,7 +450,6 @@ private:
         if (i < sv.length() - 1) { pointer = i + 1; }
       }
     }
-    return collections;
   }
 
   inline FORCE_INLINE void remove_quotation_marks(VW::string_view& sv)
@@ -463,6 +482,7 @@ void csv_parser::reset()
     label_list.clear();
     tag_list.clear();
     feature_list.clear();
+    column_plan.clear();
   }
   line_num = 0;
 }
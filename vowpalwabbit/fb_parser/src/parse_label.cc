@@ -68,14 +68,11 @@ void parser::parse_ccb_label(polylabel* l, const CCBLabel* label)
     if (label->outcome() != nullptr)
     {
       l->conditional_contextual_bandit.type = VW::ccb_example_type::SLOT;
-      auto& ccb_outcome = *(new VW::ccb_outcome());
+      auto& ccb_outcome = l->conditional_contextual_bandit.emplace_outcome();
       ccb_outcome.cost = label->outcome()->cost();
-      ccb_outcome.probabilities.clear();
 
       for (auto const& as : *(label->outcome()->probabilities()))
         ccb_outcome.probabilities.push_back({as->action(), as->score()});
-
-      l->conditional_contextual_bandit.outcome = &ccb_outcome;
     }
   }
 }
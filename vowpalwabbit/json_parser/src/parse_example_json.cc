@@ -373,15 +373,14 @@ public:
 
       if ((actions.size() != 0) && (probs.size() != 0))
       {
-        auto* outcome = new VW::ccb_outcome();
-        outcome->cost = cb_label.cost;
         if (actions.size() != probs.size()) { THROW("Actions and probabilities must be the same length."); }
+        auto& outcome = ld.emplace_outcome();
+        outcome.cost = cb_label.cost;
 
-        for (size_t i = 0; i < this->actions.size(); i++) { outcome->probabilities.push_back({actions[i], probs[i]}); }
+        for (size_t i = 0; i < this->actions.size(); i++) { outcome.probabilities.push_back({actions[i], probs[i]}); }
         actions.clear();
         probs.clear();
 
-        ld.outcome = outcome;
         cb_label = VW::cb_class{};
       }
     }
@@ -1032,11 +1031,10 @@ public:
           ctx.ex->l.conditional_contextual_bandit.type = VW::ccb_example_type::SLOT;
           ctx.examples->push_back(ctx.ex);
 
-          auto outcome = new VW::ccb_outcome();
-          outcome->cost = ctx.label_object_state.cb_label.cost;
-          outcome->probabilities.push_back(
+          auto& outcome = ctx.ex->l.conditional_contextual_bandit.emplace_outcome();
+          outcome.cost = ctx.label_object_state.cb_label.cost;
+          outcome.probabilities.push_back(
               {ctx.label_object_state.cb_label.action - 1, ctx.label_object_state.cb_label.probability});
-          ctx.ex->l.conditional_contextual_bandit.outcome = outcome;
         }
       }
     }
@@ -151,38 +151,51 @@ int main(int argc, char* argv[])
     logger.set_level(options.log_level);
     logger.set_location(options.log_output_stream);
 
-    std::vector<std::unique_ptr<VW::workspace>> models;
+    // Each custom logger keeps a pointer to its context, so the vector must not reallocate.
     std::vector<logger_context> logger_contexts;
-    for (const auto& model_file : options.input_files)
+    logger_contexts.reserve(options.input_files.size() + 2);
+    const auto load_model = [&](const std::string& model_file, const std::string& context)
     {
-      logger.info("Loading model: {}", model_file);
-      logger_contexts.push_back(logger_context{logger, model_file});
-
+      logger_contexts.push_back(logger_context{logger, context});
       auto custom_logger = VW::io::create_custom_sink_logger(&logger_contexts.back(), logger_output_func);
-      auto model = VW::initialize(VW::make_unique<VW::config::options_cli>(std::vector<std::string>{
-                                      "--driver_output_off", "--preserve_performance_counters"}),
+      return VW::initialize(VW::make_unique<VW::config::options_cli>(std::vector<std::string>{
+                                "--driver_output_off", "--preserve_performance_counters"}),
           VW::io::open_file_reader(model_file), nullptr, nullptr, &custom_logger);
-      models.push_back(std::move(model));
-    }
-
-    logger_contexts.push_back(logger_context{logger, "dest: " + options.input_files[0]});
-    auto custom_logger = VW::io::create_custom_sink_logger(&logger_contexts.back(), logger_output_func);
-    std::vector<const VW::workspace*> const_workspaces;
-    const_workspaces.reserve(models.size());
-    for (const auto& model : models) { const_workspaces.push_back(model.get()); }
+    };
 
     std::unique_ptr<VW::workspace> base_model = nullptr;
     if (!options.base_file.empty())
     {
       logger.info("Loading base model: {}", options.base_file);
-      logger_contexts.push_back(logger_context{logger, "base: " + options.base_file});
-      auto custom_logger = VW::io::create_custom_sink_logger(&logger_contexts.back(), logger_output_func);
-      base_model = VW::initialize(VW::make_unique<VW::config::options_cli>(std::vector<std::string>{
-                                      "--driver_output_off", "--preserve_performance_counters"}),
-          VW::io::open_file_reader(options.base_file), nullptr, nullptr, &custom_logger);
+      base_model = load_model(options.base_file, "base: " + options.base_file);
     }
 
-    auto merged = VW::merge_models(base_model.get(), const_workspaces, &custom_logger);
+    logger_contexts.push_back(logger_context{logger, "dest: " + options.input_files[0]});
+    auto custom_logger = VW::io::create_custom_sink_logger(&logger_contexts.back(), logger_output_func);
+
+    // Each model, or its delta from the base, is folded into a running merge as soon as it is loaded and then released,
+    // so only the base, the running merge and one model are held at a time. Merges weight every source by its example
+    // count, which makes folding them one at a time equivalent to merging them all at once, up to float rounding.
+    std::unique_ptr<VW::workspace> merged;
+    std::unique_ptr<VW::model_delta> merged_delta;
+    for (const auto& model_file : options.input_files)
+    {
+      logger.info("Loading model: {}", model_file);
+      auto model = load_model(model_file, model_file);
+      if (base_model != nullptr)
+      {
+        auto delta = VW::make_unique<VW::model_delta>(*model - *base_model);
+        model.reset();
+        if (merged_delta != nullptr)
+        {
+          delta = VW::make_unique<VW::model_delta>(VW::merge_deltas({merged_delta.get(), delta.get()}, &custom_logger));
+        }
+        merged_delta = std::move(delta);
+      }
+      else if (merged != nullptr) { merged = VW::merge_models(nullptr, {merged.get(), model.get()}, &custom_logger); }
+      else { merged = std::move(model); }
+    }
+    if (base_model != nullptr) { merged = *base_model + *merged_delta; }
 
     logger.info("Saving model: {}", options.output_file);
     VW::save_predictor(*merged, options.output_file);
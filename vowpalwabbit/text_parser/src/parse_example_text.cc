@@ -44,6 +44,8 @@ private:
   uint32_t _hash_seed;
   uint64_t _parse_mask;
   std::array<std::vector<std::shared_ptr<VW::details::feature_dict>>, VW::NUM_NAMESPACES>* _namespace_dictionaries;
+  std::array<std::vector<std::shared_ptr<const VW::details::flat_dictionary>>, VW::NUM_NAMESPACES>*
+      _namespace_flat_dictionaries;
   VW::io::logger* _logger;
 
   // TODO: Currently this function is called by both warning and error conditions. We only log
@@ -292,6 +294,32 @@ private:
           }
         }
       }
+      if (!(*_namespace_flat_dictionaries)[_index].empty())
+      {
+        VW::details::flat_dictionary_entry entry;
+        for (const auto& dict : (*_namespace_flat_dictionaries)[_index])
+        {
+          if (!dict->find(feature_name, entry)) { continue; }
+          auto& dict_fs = _ae->feature_space[VW::details::DICTIONARY_NAMESPACE];
+          if (dict_fs.empty()) { _ae->indices.push_back(VW::details::DICTIONARY_NAMESPACE); }
+          dict_fs.start_ns_extent(VW::details::DICTIONARY_NAMESPACE);
+          dict_fs.values.insert(dict_fs.values.end(), entry.values, entry.values + entry.size);
+          dict_fs.indices.insert(dict_fs.indices.end(), entry.indices, entry.indices + entry.size);
+          dict_fs.sum_feat_sq += entry.sum_feat_sq;
+          if (audit)
+          {
+            for (size_t i = 0; i < entry.size; ++i)
+            {
+              std::stringstream ss;
+              ss << _index << '_';
+              ss << feature_name;
+              ss << '=' << entry.indices[i];
+              dict_fs.space_names.emplace_back("dictionary", ss.str());
+            }
+          }
+          dict_fs.end_ns_extent();
+        }
+      }
     }
   }
 
@@ -444,6 +472,7 @@ public:
       this->_affix_features = &all.affix_features;
       this->_spelling_features = &all.spelling_features;
       this->_namespace_dictionaries = &all.namespace_dictionaries;
+      this->_namespace_flat_dictionaries = &all.namespace_flat_dictionaries;
       this->_hash_seed = all.hash_seed;
       this->_parse_mask = all.parse_mask;
       this->_logger = &all.logger;